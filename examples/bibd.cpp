@@ -100,7 +100,8 @@ public:
   enum {
     SYMMETRY_NONE,      ///< No symmetry breaking
     SYMMETRY_LEX,       ///< Lex-constraints on rows/columns
-    SYMMETRY_LDSB       ///< LDSB on rows/columns
+    SYMMETRY_LDSB,      ///< LDSB on rows/columns
+    SYMMETRY_SBDD       ///< Dominance detection on rows/columns
   };
 
   /// Actual model
@@ -130,6 +131,11 @@ public:
       s << rows_interchange(p);
       s << columns_interchange(p);
       branch(*this, _p, BOOL_VAR_NONE(), BOOL_VAL_MIN(), s);
+    } else if (opt.symmetry() == SYMMETRY_SBDD) {
+      Symmetries s;
+      s << rows_interchange(p);
+      s << columns_interchange(p);
+      sbdd(*this, _p, BOOL_VAR_NONE(), BOOL_VAL_MIN(), s);
     } else {
       if (opt.symmetry() == SYMMETRY_LEX) {
         for (int i=1; i<opt.v; i++)
@@ -183,6 +189,7 @@ main(int argc, char* argv[]) {
   opt.symmetry(BIBD::SYMMETRY_NONE,"none");
   opt.symmetry(BIBD::SYMMETRY_LEX,"lex");
   opt.symmetry(BIBD::SYMMETRY_LDSB,"ldsb");
+  opt.symmetry(BIBD::SYMMETRY_SBDD,"sbdd");
 
   opt.parse(argc,argv);
 
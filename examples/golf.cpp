@@ -81,8 +81,10 @@ class Golf : public Script {
 public:
   /// Model variants
   enum {
-    MODEL_PLAIN,   ///< A simple model
-    MODEL_SYMMETRY ///< Model with symmetry breaking
+    MODEL_PLAIN,    ///< A simple model
+    MODEL_SYMMETRY, ///< Model with symmetry breaking
+    MODEL_LDSB,     ///< Model with LDSB
+    MODEL_SBDD      ///< Model with symmetry breaking by dominance detection
   };
   /// Propagation
   enum {
@@ -194,7 +196,22 @@ public:
       precede(*this, groups, IntArgs::create(groups.size(),0));
     }
 
-    branch(*this, groups, SET_VAR_MIN_MIN(), SET_VAL_MIN_INC());
+    if ((opt.model() == MODEL_LDSB) || (opt.model() == MODEL_SBDD)) {
+      Symmetries syms;
+      // Groups within a week are interchangeable
+      for (int j=0; j<w; j++)
+        syms << VariableSymmetry(schedule.row(j));
+      // Weeks are interchangeable
+      syms << VariableSequenceSymmetry(groups, g);
+      // Players are interchangeable
+      syms << ValueSymmetry(IntSet(0,g*s-1));
+      if (opt.model() == MODEL_LDSB)
+        branch(*this, groups, SET_VAR_MIN_MIN(), SET_VAL_MIN_INC(), syms);
+      else
+        sbdd(*this, groups, SET_VAR_MIN_MIN(), SET_VAL_MIN_INC(), syms);
+    } else {
+      branch(*this, groups, SET_VAR_MIN_MIN(), SET_VAL_MIN_INC());
+    }
   }
 
   /// Print solution
@@ -228,6 +245,8 @@ main(int argc, char* argv[]) {
   opt.model(Golf::MODEL_PLAIN);
   opt.model(Golf::MODEL_PLAIN, "none", "no symmetry breaking");
   opt.model(Golf::MODEL_SYMMETRY, "symmetry", "static symmetry breaking");
+  opt.model(Golf::MODEL_LDSB, "ldsb", "symmetry breaking by LDSB");
+  opt.model(Golf::MODEL_SBDD, "sbdd", "symmetry breaking by dominance detection");
   opt.propagation(Golf::PROP_SET);
   opt.propagation(Golf::PROP_SET, "set", "Use set intersection cardinality for pair play constraints");
   opt.propagation(Golf::PROP_INT, "int", "Use integer distinct for pair play constraints");
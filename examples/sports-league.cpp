@@ -212,6 +212,11 @@ protected:
   }
 
 public:
+  /// Symmetry breaking variants
+  enum {
+    SYMMETRY_STATIC, ///< Static symmetry breaking
+    SYMMETRY_LDSB    ///< LDSB for periods and weeks
+  };
   /// Setup model
   SportsLeague(const SizeOptions& opt) :
     Script(opt),
@@ -244,17 +249,17 @@ public:
       for (int w=0; w<teams; w++)
         rel(*this, h(p,w), IRT_LE, a(p,w));
 
-    // Home teams in first week are ordered
-    {
+    if (opt.symmetry() == SYMMETRY_STATIC) {
+      // Home teams in first week are ordered
       IntVarArgs h0(periods());
       for (int p=0; p<periods(); p++)
         h0[p] = h(p,0);
       rel(*this, h0, IRT_LE);
-    }
 
-    // Fix first pair
-    rel(*this, h(0,0), IRT_EQ, 1);
-    rel(*this, a(0,0), IRT_EQ, 2);
+      // Fix first pair
+      rel(*this, h(0,0), IRT_EQ, 1);
+      rel(*this, a(0,0), IRT_EQ, 2);
+    }
 
     /// Column constraint: each team occurs exactly once
     for (int w=0; w<teams; w++) {
@@ -285,7 +290,20 @@ public:
 
     distinct(*this, game, opt.ipl());
 
-    branch(*this, game, INT_VAR_NONE(), INT_VAL_SPLIT_MIN());
+    if (opt.symmetry() == SYMMETRY_LDSB) {
+      Symmetries s;
+      // Periods are interchangeable
+      s << VariableSequenceSymmetry(game, weeks());
+      // Weeks are interchangeable
+      IntVarArgs c;
+      for (int w=0; w<weeks(); w++)
+        for (int p=0; p<periods(); p++)
+          c << g(p,w);
+      s << VariableSequenceSymmetry(c, periods());
+      branch(*this, game, INT_VAR_NONE(), INT_VAL_MIN(), s);
+    } else {
+      branch(*this, game, INT_VAR_NONE(), INT_VAL_SPLIT_MIN());
+    }
   }
   /// Constructor for cloning \a s
   SportsLeague(SportsLeague& s)
@@ -334,6 +352,11 @@ main(int argc, char* argv[]) {
   SizeOptions opt("Sports League Scheduling");
   opt.ipl(IPL_DOM);
   opt.size(18);
+  opt.symmetry(SportsLeague::SYMMETRY_STATIC);
+  opt.symmetry(SportsLeague::SYMMETRY_STATIC, "static",
+               "static symmetry breaking");
+  opt.symmetry(SportsLeague::SYMMETRY_LDSB, "ldsb",
+               "symmetry breaking by LDSB");
   opt.parse(argc,argv);
   if (opt.size() < 5) {
     std::cerr<< "No Solution for less than 5 teams!" << std::endl;
@@ -408,6 +408,7 @@ namespace Gecode {
     Driver::StringValueOption _out_file;      ///< Where to print solutions
     Driver::StringValueOption _log_file;      ///< Where to print statistics
     Driver::TraceOption       _trace;         ///< Trace flags for tracing
+    Driver::BoolOption        _profile;       ///< Whether to profile execution
 
 #ifdef GECODE_HAS_CPPROFILER
     Driver::IntOption         _profiler_id;   ///< Use this execution id for the CP-profiler
@@ -604,6 +605,11 @@ namespace Gecode {
     /// Return trace flags
     int trace(void) const;
 
+    /// Set whether to profile execution
+    void profile(bool b);
+    /// Return whether to profile execution
+    bool profile(void) const;
+
 #ifdef GECODE_HAS_CPPROFILER
     /// Set profiler execution identifier
     void profiler_id(int i);
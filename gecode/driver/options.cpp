@@ -618,7 +618,9 @@ namespace Gecode {
                 "(supports stdout, stdlog, stderr)","stdout"),
       _log_file("file-stat", "where to print statistics "
                 "(supports stdout, stdlog, stderr)","stdout"),
-      _trace(0)
+      _trace(0),
+      _profile("profile","whether to print profile information "
+               "(solution and stat mode)",false)
 
 #ifdef GECODE_HAS_CPPROFILER
       ,
@@ -651,7 +653,7 @@ namespace Gecode {
     add(_nogoods); add(_nogoods_limit);
     add(_relax);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
-    add(_out_file); add(_log_file); add(_trace);
+    add(_out_file); add(_log_file); add(_trace); add(_profile);
 #ifdef GECODE_HAS_CPPROFILER
     add(_profiler_id);
     add(_profiler_port);
@@ -505,6 +505,16 @@ namespace Gecode {
     return _trace.value();
   }
 
+  inline void
+  Options::profile(bool b) {
+    _profile.value(b);
+  }
+
+  inline bool
+  Options::profile(void) const {
+    return _profile.value();
+  }
+
 #ifdef GECODE_HAS_CPPROFILER
 
   /*
@@ -35,6 +35,8 @@
 #include <gecode/driver.hh>
 
 #include <cmath>
+#include <vector>
+#include <algorithm>
 
 namespace Gecode { namespace Driver {
 
@@ -70,6 +72,41 @@ namespace Gecode { namespace Driver {
   }
 
 
+  void
+  profile(const Search::Statistics& stat, std::ostream& os,
+          const char* prefix) {
+    using namespace std;
+    const PropagatorProfile& pp = stat.profile;
+    os << prefix << "Profile" << endl
+       << prefix << "\tclones:       " << stat.clone << endl
+       << prefix << "\tclone memory: " << ((stat.bytes+1023) / 1024)
+       << " KB" << endl
+       << prefix << "\tclone ticks:  " << stat.ticks << endl
+       << prefix << "\tcommits:      " << stat.commit << endl;
+    // Print propagator classes by decreasing time spent
+    vector<int> c(static_cast<size_t>(pp.entries()));
+    unsigned long long int t = 0;
+    for (int i=0; i<pp.entries(); i++) {
+      c[static_cast<size_t>(i)] = i; t += pp[i].ticks;
+    }
+    sort(c.begin(), c.end(), [&pp](int i, int j) {
+        return pp[i].ticks > pp[j].ticks;
+      });
+    for (int i : c) {
+      const PropagatorProfile::Entry& e = pp[i];
+      os << prefix << "\t" << e.name << endl
+         << prefix << "\t\texecutions: " << e.propagate
+         << " (fix " << e.fix << ", nofix " << e.nofix
+         << ", subsumed " << e.subsumed << ", failed " << e.failed << ")"
+         << endl
+         << prefix << "\t\tprunings:   " << e.prune << endl
+         << prefix << "\t\tticks:      " << e.ticks << " ("
+         << fixed << setprecision(2)
+         << ((t > 0) ? (100.0 * e.ticks / t) : 0.0) << "%)" << endl;
+    }
+    os << endl;
+  }
+
   double
   am(double t[], unsigned int n) {
     if (n < 1)
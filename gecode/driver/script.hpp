@@ -135,6 +135,15 @@ namespace Gecode { namespace Driver {
   GECODE_DRIVER_EXPORT void
   stop(Support::Timer& t, std::ostream& os);
 
+  /**
+   * \brief Print profile information from statistics \a stat
+   *
+   * Every line printed starts with \a prefix.
+   */
+  GECODE_DRIVER_EXPORT void
+  profile(const Search::Statistics& stat, std::ostream& os,
+          const char* prefix = "");
+
   /**
    * \brief Compute arithmetic mean of \a n elements in \a t
    */
@@ -369,6 +378,8 @@ namespace Gecode { namespace Driver {
             s = new Script(o);
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
+          if (o.profile())
+            s->profile(true);
           so.threads = o.threads();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
@@ -436,6 +447,8 @@ namespace Gecode { namespace Driver {
                   << "\truntime:      ";
             stop(t, l_out);
             l_out << endl
+                  << "\tcpu time:     "
+                  << setprecision(3) << stat.cpu << " ms" << endl
                   << "\tsolutions:    "
                   << ::abs(static_cast<int>(o.solutions()) - i) << endl
                   << "\tpropagations: " << stat.propagate << endl
@@ -450,6 +463,8 @@ namespace Gecode { namespace Driver {
                   << endl
 #endif
                   << endl;
+            if (o.profile())
+              Driver::profile(stat,l_out);
           }
           delete so.stop;
           delete so.tracer;
@@ -465,6 +480,8 @@ namespace Gecode { namespace Driver {
             s = new Script(o);
           unsigned int n_p = PropagatorGroup::all.size(*s);
           unsigned int n_b = BrancherGroup::all.size(*s);
+          if (o.profile())
+            s->profile(true);
 
           so.clone   = false;
           so.threads = o.threads();
@@ -496,6 +513,8 @@ namespace Gecode { namespace Driver {
                   << "\truntime:      ";
             stop(t, l_out);
             l_out << endl
+                  << "\tcpu time:     "
+                  << setprecision(3) << stat.cpu << " ms" << endl
                   << "\tsolutions:    "
                   << ::abs(static_cast<int>(o.solutions()) - i) << endl
                   << "\tpropagations: " << stat.propagate << endl
@@ -510,6 +529,8 @@ namespace Gecode { namespace Driver {
                   << endl
 #endif
                   << endl;
+            if (o.profile())
+              Driver::profile(stat,l_out);
           }
           delete so.stop;
         }
@@ -195,6 +195,8 @@ namespace Gecode { namespace FlatZinc {
     void addSetVarName(const std::string& n);
     const std::string& setVarName(int i) const { return sv_names[i]; }
 #endif
+    /// Return new reference to the variable named \a n (NULL if none)
+    AST::Node* lookup(const std::string& n) const;
 
     void shrinkElement(AST::Node* node,
                        std::map<int,int>& iv, std::map<int,int>& bv,
@@ -239,6 +241,8 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _time;      ///< Cutoff for time
       Gecode::Driver::UnsignedIntOption _time_limit;  ///< Cutoff for time (for compatibility with flatzinc command line)
       Gecode::Driver::IntOption         _seed;      ///< Random seed
+      Gecode::Driver::UnsignedIntOption _runs;      ///< Number of runs
+      Gecode::Driver::UnsignedIntOption _assets;    ///< Number of assets in a portfolio
       Gecode::Driver::StringOption      _restart;   ///< Restart method option
       Gecode::Driver::DoubleOption      _r_base;    ///< Restart base
       Gecode::Driver::UnsignedIntOption _r_scale;   ///< Restart scale factor
@@ -252,6 +256,7 @@ namespace Gecode { namespace FlatZinc {
       //@{
       Gecode::Driver::StringOption      _mode;       ///< Script mode to run
       Gecode::Driver::BoolOption        _stat;       ///< Emit statistics
+      Gecode::Driver::BoolOption        _profile;    ///< Emit profile information
       Gecode::Driver::StringValueOption _output;     ///< Output file
 
 #ifdef GECODE_HAS_CPPROFILER
@@ -280,6 +285,8 @@ namespace Gecode { namespace FlatZinc {
       _time("time","time (in ms) cutoff (0 = none, solution mode)"),
       _time_limit("t","time (in ms) cutoff (0 = none, solution mode)"),
       _seed("r","random seed",0),
+      _runs("runs","number of runs with consecutive seeds (model is posted once)",1),
+      _assets("assets","number of assets in a portfolio of search strategies (0 = none)",0),
       _restart("restart","restart sequence type",RM_NONE),
       _r_base("restart-base","base for geometric restart sequence",1.5),
       _r_scale("restart-scale","scale factor for restart sequence",250),
@@ -291,6 +298,7 @@ namespace Gecode { namespace FlatZinc {
       _step("step","step distance for float optimization",0.0),
       _mode("mode","how to execute script",Gecode::SM_SOLUTION),
       _stat("s","emit statistics"),
+      _profile("profile","emit profile information"),
       _output("o","file to send output to")
 
 #ifdef GECODE_HAS_CPPROFILER
@@ -316,11 +324,11 @@ namespace Gecode { namespace FlatZinc {
       add(_free);
       add(_decay);
       add(_node); add(_fail); add(_time); add(_time_limit); add(_interrupt);
-      add(_seed);
+      add(_seed); add(_runs); add(_assets);
       add(_step);
       add(_restart); add(_r_base); add(_r_scale);
       add(_nogoods); add(_nogoods_limit);
-      add(_mode); add(_stat);
+      add(_mode); add(_stat); add(_profile);
       add(_output);
 #ifdef GECODE_HAS_CPPROFILER
       add(_profiler_id);
@@ -358,8 +366,12 @@ namespace Gecode { namespace FlatZinc {
     unsigned int fail(void) const { return _fail.value(); }
     unsigned int time(void) const { return _time.value(); }
     int seed(void) const { return _seed.value(); }
+    unsigned int runs(void) const { return _runs.value(); }
+    unsigned int assets(void) const { return _assets.value(); }
+    void assets(unsigned int n) { _assets.value(n); }
     double step(void) const { return _step.value(); }
     const char* output(void) const { return _output.value(); }
+    bool profile(void) const { return _profile.value(); }
 
     Gecode::ScriptMode mode(void) const {
       return static_cast<Gecode::ScriptMode>(_mode.value());
@@ -455,23 +467,48 @@ namespace Gecode { namespace FlatZinc {
     /// Percentage of variables to keep in LNS (or 0 for no LNS)
     unsigned int _lns;
 
+    /// Percentage of variables to keep in the next LNS neighbourhood
+    unsigned int _lnsRate;
+
     /// Initial solution to start the LNS (or NULL for no LNS)
     IntSharedArray _lnsInitialSolution;
 
+    /// Bounds for the random values of iv_restart_uniform (two per variable)
+    IntSharedArray _uniformBounds;
+
     /// Random number generator
     Rnd _random;
 
+    /// Random number generator for random branchers
+    Rnd _branchRandom;
+
     /// Annotations on the solve item
     AST::Array* _solveAnnotations;
 
+    /// Brancher group of each portfolio asset (all for the search annotation)
+    std::vector<BrancherGroup> _assetBranchers;
+
     /// Copy constructor
     FlatZincSpace(FlatZincSpace&);
+    /// Remove duplicate and entailed constraints from \a ces
+    void presolveConstraints(std::vector<ConExpr*>& ces);
+    /// Replace cliques of disequalities in \a ces by distinct constraints
+    void detectConstraints(std::vector<ConExpr*>& ces);
+    /// Create tuple sets for the table constraints in \a ces in parallel
+    void prepareConstraints(std::vector<ConExpr*>& ces);
+    /// Return tuple set equal to \a ts that is shared with other constraints
+    TupleSet sharedTupleSet(const TupleSet& ts);
   private:
     /// Run the search engine
     template<template<class> class Engine>
     void
     runEngine(std::ostream& out, const Printer& p,
               const FlatZincOptions& opt, Gecode::Support::Timer& t_total);
+    /// Create the engine builders \a sebs for the assets of a portfolio
+    template<template<class> class Engine>
+    void
+    createAssets(SEBs& sebs, const FlatZincOptions& opt,
+                 const Search::Options& o);
     /// Run the meta search engine
     template<template<class> class Engine,
              template<class, template<class> class> class Meta>
@@ -489,6 +526,19 @@ namespace Gecode { namespace FlatZinc {
     /// The integer variables used in LNS
     Gecode::IntVarArray iv_lns;
 
+    /// Integer variables whose values in the last solution are used on restart
+    Gecode::IntVarArray iv_restart_sol;
+    /// Integer variables fixed to the values of iv_restart_sol on restart
+    Gecode::IntVarArray iv_restart_val;
+    /// Boolean variables whose values in the last solution are used on restart
+    Gecode::BoolVarArray bv_restart_sol;
+    /// Boolean variables fixed to the values of bv_restart_sol on restart
+    Gecode::BoolVarArray bv_restart_val;
+    /// Integer variables fixed to random values on restart
+    Gecode::IntVarArray iv_restart_uniform;
+    /// Integer variables fixed to the status of the previous run on restart
+    Gecode::IntVarArray iv_restart_status;
+
     /// Indicates whether an integer variable is introduced by mzn2fzn
     std::vector<bool> iv_introduced;
     /// Indicates whether an integer variable aliases a Boolean variable
@@ -543,6 +593,15 @@ namespace Gecode { namespace FlatZinc {
 
     /// Post a constraint specified by \a ce
     void postConstraints(std::vector<ConExpr*>& ces);
+    /**
+     * \brief Use \a n threads to prepare constraints for posting
+     *
+     * Before constraints are posted, the tuple sets for table
+     * constraints are created by \a n threads in parallel (if Gecode
+     * has been compiled with thread support). Must be called before
+     * the model is parsed into this space.
+     */
+    void prepareThreads(unsigned int n);
 
     /// Post the solve item
     void solve(AST::Array* annotation);
@@ -555,6 +614,32 @@ namespace Gecode { namespace FlatZinc {
     void run(std::ostream& out, const Printer& p,
              const FlatZincOptions& opt, Gecode::Support::Timer& t_total);
 
+    /**
+     * \brief Post constraint \a ce
+     *
+     * Variables in \a ce refer to the variables of the parsed model,
+     * references can be obtained from the printer by Printer::lookup.
+     * This can be used for adding constraints to a root space that has
+     * been solved before and solving it again with run, without parsing
+     * the model again. Constraints must not be posted after shrinkArrays
+     * has been called.
+     *
+     * Throws an exception of type FlatZinc::Error if \a ce cannot be
+     * posted.
+     *
+     */
+    void postConstraint(const ConExpr& ce);
+
+    /**
+     * \brief Set seed \a s for the random branchers and for LNS
+     *
+     * As search engines run on clones of this space, the seed can be
+     * changed before each call to run, so that the same posted model can
+     * be solved several times with different seeds.
+     *
+     */
+    void reseed(unsigned int s);
+
     /// Produce output on \a out using \a p
     void print(std::ostream& out, const Printer& p) const;
 #ifdef GECODE_HAS_CPPROFILER
@@ -595,6 +680,10 @@ namespace Gecode { namespace FlatZinc {
      *
      * The seed for random branchers is given by the \a seed parameter.
      *
+     * If the options request a portfolio with several assets, additional
+     * free search branchers are created for the assets that do not
+     * follow the search annotation.
+     *
      */
     void createBranchers(Printer& p, AST::Node* ann,
                          FlatZincOptions& opt, bool ignoreUnknown,
@@ -606,11 +695,30 @@ namespace Gecode { namespace FlatZinc {
     /// Information for printing branches
     BranchInformation branchInfo;
 
+    /// \name Builtins for restart-based search (on_restart)
+    //@{
+    /// Fix \a y on every restart to the value of \a x in the last solution
+    void restartSol(IntVar x, IntVar y);
+    /// Fix \a y on every restart to the value of \a x in the last solution
+    void restartSol(BoolVar x, BoolVar y);
+    /// Fix \a x on every restart to a random value between \a l and \a u
+    void restartUniform(int l, int u, IntVar x);
+    /**
+     * \brief Fix \a x on every restart to the status of the previous run
+     *
+     * The values follow the MiniZinc enumeration (1 for the first run,
+     * 2 if the status is unknown, and 4 if a solution has been found).
+     */
+    void restartStatus(IntVar x);
+    //@}
+
     /// Implement optimization
     virtual void constrain(const Space& s);
     /// Copy function
     virtual Gecode::Space* copy(void);
-    /// Slave function for restarts
+    /// Master function for restarts and portfolios (adapts the LNS neighbourhood size)
+    virtual bool master(const MetaInfo& mi);
+    /// Slave function for restarts and portfolios
     virtual bool slave(const MetaInfo& mi);
 
     /// \name AST to variable and value conversion
@@ -637,6 +745,8 @@ namespace Gecode { namespace FlatZinc {
     IntVar arg2IntVar(AST::Node* n);
     /// Convert \a a to TupleSet
     TupleSet arg2tupleset(const IntArgs& a, int noOfVars);
+    /// Convert \a arg (array of integers or Booleans) to TupleSet
+    TupleSet arg2tupleset(AST::Node* arg, int noOfVars);
     /// Check if \a b is array of Booleans (or has a single integer)
     bool isBoolArray(AST::Node* b, int& singleInt);
 #ifdef GECODE_HAS_SET_VARS
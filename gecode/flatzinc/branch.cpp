@@ -121,12 +121,15 @@ namespace Gecode { namespace FlatZinc {
          IntBoolVarBranch vars, IntValBranch vals) {
     if (home.failed()) return;
     vars.expand(home,x,y);
+    vals.expand(home,x);
+    BoolValBranch bvals = i2b(vals);
+    bvals.expand(home,y);
     ViewArray<Int::IntView> xv(home,x);
     ViewArray<Int::BoolView> yv(home,y);
     ValSelCommitBase<Int::IntView,int>* xvsc =
       Int::Branch::valselcommit(home,vals);
     ValSelCommitBase<Int::BoolView,int>* yvsc =
-      Int::Branch::valselcommit(home,i2b(vals));
+      Int::Branch::valselcommit(home,bvals);
     switch (vars.select()) {
     case IntBoolVarBranch::SEL_AFC_MAX:
       {
@@ -431,6 +431,8 @@ namespace Gecode { namespace FlatZinc {
       return BOOL_VAL_MAX();
     case IntValBranch::SEL_RND:
       return BOOL_VAL_RND(ivb.rnd());
+    case IntValBranch::SEL_PHASE:
+      return BOOL_VAL_PHASE();
     case IntValBranch::SEL_VAL_COMMIT:
     default:
     GECODE_NEVER;
@@ -47,6 +47,8 @@
 #include <sstream>
 #include <limits>
 #include <unordered_set>
+#include <unordered_map>
+#include <deque>
 
 
 namespace std {
@@ -477,6 +479,10 @@ namespace Gecode { namespace FlatZinc {
         r0 = "="; r1 = "=";
         return INT_VALUES_MIN();
       }
+      if (s->id == "indomain_phase") {
+        r0 = "="; r1 = "!=";
+        return INT_VAL_PHASE();
+      }
       if (s->id == "indomain_middle") {
         std::cerr << "Warning, replacing unsupported annotation "
                   << "indomain_middle with indomain_median" << std::endl;
@@ -580,6 +586,10 @@ namespace Gecode { namespace FlatZinc {
         r0 = "="; r1 = "=";
         return BOOL_VAL_MIN();
       }
+      if (s->id == "indomain_phase") {
+        r0 = "="; r1 = "!=";
+        return BOOL_VAL_PHASE();
+      }
       if (s->id == "indomain_middle") {
         std::cerr << "Warning, replacing unsupported annotation "
                   << "indomain_middle with indomain_median" << std::endl;
@@ -766,15 +776,35 @@ namespace Gecode { namespace FlatZinc {
     typedef std::unordered_set<DFA> DFASet;
     /// Hash table of DFAs
     DFASet dfaSet;
-    
+
+    /// Map of tuple sets prepared for the tuple arrays of constraints
+    typedef std::unordered_map<const AST::Node*,TupleSet> PreparedTupleSets;
+    /// Map of tuple sets prepared for the tuple arrays of constraints
+    PreparedTupleSets preparedTupleSets;
+
+    /// Number of threads for preparing constraints
+    unsigned int threads;
+
+    /// Number of variables that are aliases of other variables
+    unsigned int aliases;
+    /// Number of constraints dropped as duplicates
+    unsigned int duplicates;
+    /// Number of constraints dropped as entailed
+    unsigned int entailed;
+    /// Number of distinct constraints detected from disequalities
+    unsigned int distinct;
+
     /// Initialize
-    FlatZincSpaceInitData(void) {}
+    FlatZincSpaceInitData(void)
+      : threads(1U), aliases(0U), duplicates(0U), entailed(0U),
+        distinct(0U) {}
   };
 
   FlatZincSpace::FlatZincSpace(FlatZincSpace& f)
     : Space(f),
-      _initData(NULL), _random(f._random),
-      _solveAnnotations(NULL), iv_boolalias(NULL),
+      _initData(NULL), _random(f._random), _branchRandom(f._branchRandom),
+      _solveAnnotations(NULL), _assetBranchers(f._assetBranchers),
+      iv_boolalias(NULL),
 #ifdef GECODE_HAS_FLOAT_VARS
       step(f.step),
 #endif
@@ -783,10 +813,18 @@ namespace Gecode { namespace FlatZinc {
       _optVarIsInt = f._optVarIsInt;
       _method = f._method;
       _lns = f._lns;
+      _lnsRate = f._lnsRate;
       _lnsInitialSolution = f._lnsInitialSolution;
+      _uniformBounds = f._uniformBounds;
       branchInfo = f.branchInfo;
       iv.update(*this, f.iv);
       iv_lns.update(*this, f.iv_lns);
+      iv_restart_sol.update(*this, f.iv_restart_sol);
+      iv_restart_val.update(*this, f.iv_restart_val);
+      bv_restart_sol.update(*this, f.bv_restart_sol);
+      bv_restart_val.update(*this, f.bv_restart_val);
+      iv_restart_uniform.update(*this, f.iv_restart_uniform);
+      iv_restart_status.update(*this, f.iv_restart_status);
       intVarCount = f.intVarCount;
 
       if (needAuxVars) {
@@ -846,7 +884,8 @@ namespace Gecode { namespace FlatZinc {
   FlatZincSpace::FlatZincSpace(Rnd& random)
   :  _initData(new FlatZincSpaceInitData),
     intVarCount(-1), boolVarCount(-1), floatVarCount(-1), setVarCount(-1),
-    _optVar(-1), _optVarIsInt(true), _lns(0), _lnsInitialSolution(0),
+    _optVar(-1), _optVarIsInt(true), _lns(0), _lnsRate(0),
+    _lnsInitialSolution(0), _uniformBounds(0),
     _random(random),
     _solveAnnotations(NULL), needAuxVars(true) {
     branchInfo.init();
@@ -881,6 +920,8 @@ namespace Gecode { namespace FlatZinc {
   FlatZincSpace::newIntVar(IntVarSpec* vs) {
     if (vs->alias) {
       iv[intVarCount++] = iv[vs->i];
+      if (_initData)
+        _initData->aliases++;
     } else {
       IntSet dom(vs2is(vs));
       if (dom.size()==0) {
@@ -908,6 +949,8 @@ namespace Gecode { namespace FlatZinc {
   FlatZincSpace::newBoolVar(BoolVarSpec* vs) {
     if (vs->alias) {
       bv[boolVarCount++] = bv[vs->i];
+      if (_initData)
+        _initData->aliases++;
     } else {
       bv[boolVarCount++] = BoolVar(*this, vs2bsl(vs), vs2bsh(vs));
     }
@@ -920,6 +963,8 @@ namespace Gecode { namespace FlatZinc {
   FlatZincSpace::newSetVar(SetVarSpec* vs) {
     if (vs->alias) {
       sv[setVarCount++] = sv[vs->i];
+      if (_initData)
+        _initData->aliases++;
     } else if (vs->assigned) {
       assert(vs->upperBound());
       AST::SetLit* vsv = vs->upperBound.some();
@@ -967,6 +1012,8 @@ namespace Gecode { namespace FlatZinc {
   FlatZincSpace::newFloatVar(FloatVarSpec* vs) {
     if (vs->alias) {
       fv[floatVarCount++] = fv[vs->i];
+      if (_initData)
+        _initData->aliases++;
     } else {
       double dmin, dmax;
       if (vs->domain()) {
@@ -998,27 +1045,370 @@ namespace Gecode { namespace FlatZinc {
         return ce0->args->a.size() < ce1->args->a.size();
       }
     };
+
+    /// Maximal number of array elements of constraints checked for duplicates
+    const unsigned int presolve_key_limit = 64U;
+
+    /// Return number of array elements in the arguments of \a ce
+    unsigned int conSize(const ConExpr& ce) {
+      unsigned int n = 0U;
+      for (unsigned int i=0; i<ce.args->a.size(); i++)
+        if (ce[i]->isArray())
+          n += static_cast<unsigned int>(ce[i]->getArray()->a.size());
+      return n;
+    }
+
+    /// Write key for \a n to \a os where variables are identified by their implementation
+    void conKey(FlatZincSpace& s, AST::Node* n, std::ostream& os) {
+      if (n->isIntVar()) {
+        os << "i" << s.iv[n->getIntVar()].varimp();
+      } else if (n->isBoolVar()) {
+        os << "b" << s.bv[n->getBoolVar()].varimp();
+#ifdef GECODE_HAS_SET_VARS
+      } else if (n->isSetVar()) {
+        os << "s" << s.sv[n->getSetVar()].varimp();
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      } else if (n->isFloatVar()) {
+        os << "f" << s.fv[n->getFloatVar()].varimp();
+#endif
+      } else if (n->isArray()) {
+        AST::Array* a = n->getArray();
+        os << "[";
+        for (unsigned int i=0; i<a->a.size(); i++) {
+          conKey(s,a->a[i],os); os << ",";
+        }
+        os << "]";
+      } else {
+        n->print(os);
+      }
+    }
+
+    /// Return key for \a ce identifying equal constraints on the same variables
+    std::string conKey(FlatZincSpace& s, const ConExpr& ce) {
+      std::ostringstream os;
+      os.precision(17);
+      os << ce.id << "(";
+      for (unsigned int i=0; i<ce.args->a.size(); i++) {
+        conKey(s,ce[i],os); os << ",";
+      }
+      os << ")";
+      if (ce.ann != NULL)
+        ce.ann->print(os);
+      return os.str();
+    }
+
+    /// Get bounds \a l and \a u of integer or Boolean argument \a n
+    bool conBounds(FlatZincSpace& s, AST::Node* n, int& l, int& u) {
+      if (n->isIntVar()) {
+        IntVar x(s.iv[n->getIntVar()]);
+        l = x.min(); u = x.max();
+        return true;
+      } else if (n->isBoolVar()) {
+        BoolVar x(s.bv[n->getBoolVar()]);
+        l = x.min(); u = x.max();
+        return true;
+      } else if (n->isInt(l)) {
+        u = l;
+        return true;
+      } else if (n->isBool()) {
+        l = u = n->getBool() ? 1 : 0;
+        return true;
+      }
+      return false;
+    }
+
+    /// Test whether the relation \a ce is entailed by the current domains
+    bool conEntailed(FlatZincSpace& s, const ConExpr& ce) {
+      if (ce.args->a.size() != 2)
+        return false;
+      std::string r;
+      if (ce.id.compare(0,4,"int_") == 0)
+        r = ce.id.substr(4);
+      else if (ce.id.compare(0,5,"bool_") == 0)
+        r = ce.id.substr(5);
+      else
+        return false;
+      int xl, xu, yl, yu;
+      if (!conBounds(s,ce[0],xl,xu) || !conBounds(s,ce[1],yl,yu))
+        return false;
+      if (r == "eq")
+        return (xl == xu) && (yl == yu) && (xl == yl);
+      if (r == "ne")
+        return (xu < yl) || (yu < xl);
+      if (r == "le")
+        return xu <= yl;
+      if (r == "lt")
+        return xu < yl;
+      if (r == "ge")
+        return xl >= yu;
+      if (r == "gt")
+        return xl > yu;
+      return false;
+    }
+
+    /// Disequality graph used for detecting distinct constraints
+    class NeGraph {
+    public:
+      /// The variables (nodes)
+      std::vector<IntVar> x;
+      /// Neighbours of each node
+      std::vector<std::unordered_set<int> > nb;
+      /// Disequality constraints (as positions) for each edge
+      std::unordered_map<long long int,std::vector<unsigned int> > ce;
+      /// Map from variable implementation to node
+      std::unordered_map<const void*,int> node;
+      /// Return node for variable \a y
+      int add(IntVar y) {
+        std::unordered_map<const void*,int>::iterator it =
+          node.find(y.varimp());
+        if (it != node.end())
+          return it->second;
+        int n = static_cast<int>(x.size());
+        node[y.varimp()] = n;
+        x.push_back(y);
+        nb.push_back(std::unordered_set<int>());
+        return n;
+      }
+      /// Return key for edge between nodes \a i and \a j
+      static long long int edge(int i, int j) {
+        if (i > j)
+          std::swap(i,j);
+        return static_cast<long long int>(i) << 32 | j;
+      }
+      /// Add edge for disequality constraint at position \a c
+      void add(int i, int j, unsigned int c) {
+        nb[i].insert(j); nb[j].insert(i);
+        ce[edge(i,j)].push_back(c);
+      }
+    };
+
+    /// Order nodes by decreasing degree
+    class NeGraphOrder {
+    public:
+      /// The graph
+      const NeGraph& g;
+      /// Initialize
+      NeGraphOrder(const NeGraph& g0) : g(g0) {}
+      /// Compare nodes \a i and \a j
+      bool operator ()(int i, int j) const {
+        return g.nb[i].size() > g.nb[j].size();
+      }
+    };
+
+    /// Tuple set prepared for the tuple array \a a of a table constraint
+    class PreparedTupleSet {
+    public:
+      /// The tuple array (NULL if preparation failed)
+      const AST::Node* a;
+      /// The tuple set
+      TupleSet ts;
+    };
+
+    /// Job for creating the tuple set of a table constraint
+    class TupleSetJob : public Support::Job<PreparedTupleSet> {
+    protected:
+      /// The tuple array
+      AST::Node* a;
+      /// The arity of the tuples
+      int arity;
+    public:
+      /// Initialize
+      TupleSetJob(AST::Node* a0, int arity0) : a(a0), arity(arity0) {}
+      /// Create tuple set
+      virtual PreparedTupleSet run(int) {
+        PreparedTupleSet p;
+        p.a = NULL;
+        try {
+          AST::Array* t = a->getArray();
+          int n = (arity > 0) ? static_cast<int>(t->a.size()) / arity : 0;
+          TupleSet ts(arity);
+          IntArgs tuple(arity);
+          for (int i=0; i<n; i++) {
+            for (int j=0; j<arity; j++) {
+              AST::Node* v = t->a[i*arity+j];
+              tuple[j] = v->isBool() ? v->getBool() : v->getInt();
+            }
+            ts.add(tuple);
+          }
+          ts.finalize();
+          p.a = a; p.ts = ts;
+        } catch (...) {
+          // Errors are reported when the constraint is posted
+        }
+        return p;
+      }
+    };
+
+    /// Iterator over jobs for the table constraints in \a ces
+    class TupleSetJobs {
+    protected:
+      /// The constraints
+      const std::vector<ConExpr*>& ces;
+      /// Position of next table constraint
+      unsigned int i;
+      /// Move to next table constraint
+      void next(void) {
+        while ((i < ces.size()) &&
+               (ces[i]->id.compare(0,13,"gecode_table_") != 0))
+          i++;
+      }
+    public:
+      /// Initialize
+      TupleSetJobs(const std::vector<ConExpr*>& ces0) : ces(ces0), i(0U) {
+        next();
+      }
+      /// Test whether there are jobs left
+      bool operator ()(void) const {
+        return i < ces.size();
+      }
+      /// Return job for the next table constraint
+      TupleSetJob* job(void) {
+        const ConExpr& ce = *ces[i++];
+        next();
+        return new TupleSetJob(ce[1],
+                               static_cast<int>(ce[0]->getArray()->a.size()));
+      }
+    };
   }
 
   void
-  FlatZincSpace::postConstraints(std::vector<ConExpr*>& ces) {
-    ConExprOrder ceo;
-    std::sort(ces.begin(), ces.end(), ceo);
+  FlatZincSpace::prepareThreads(unsigned int n) {
+    if (_initData)
+      _initData->threads = std::max(n,1U);
+  }
+
+  void
+  FlatZincSpace::prepareConstraints(std::vector<ConExpr*>& ces) {
+#ifdef GECODE_HAS_THREADS
+    if ((_initData == NULL) || (_initData->threads <= 1U))
+      return;
+    TupleSetJobs tsj(ces);
+    Support::RunJobs<TupleSetJobs,PreparedTupleSet>
+      rj(tsj,_initData->threads);
+    PreparedTupleSet p;
+    while (rj.run(p))
+      if (p.a != NULL)
+        _initData->preparedTupleSets[p.a] = p.ts;
+#else
+    (void) ces;
+#endif
+  }
 
+  void
+  FlatZincSpace::presolveConstraints(std::vector<ConExpr*>& ces) {
+    if ((_initData == NULL) || failed())
+      return;
+    std::unordered_set<std::string> keys;
+    unsigned int j=0;
     for (unsigned int i=0; i<ces.size(); i++) {
       const ConExpr& ce = *ces[i];
       try {
-        registry().post(*this, ce);
-      } catch (Gecode::Exception& e) {
-        throw FlatZinc::Error("Gecode", e.what());
-      } catch (AST::TypeError& e) {
-        throw FlatZinc::Error("Type error", e.what());
+        if (conEntailed(*this,ce)) {
+          _initData->entailed++;
+          delete ces[i];
+          continue;
+        }
+        if ((conSize(ce) <= presolve_key_limit) &&
+            !keys.insert(conKey(*this,ce)).second) {
+          _initData->duplicates++;
+          delete ces[i];
+          continue;
+        }
+      } catch (AST::TypeError&) {
+        // Errors are reported when the constraint is posted
       }
+      ces[j++] = ces[i];
+    }
+    ces.resize(j);
+  }
+
+  void
+  FlatZincSpace::detectConstraints(std::vector<ConExpr*>& ces) {
+    if ((_initData == NULL) || failed())
+      return;
+    NeGraph g;
+    for (unsigned int i=0; i<ces.size(); i++) {
+      const ConExpr& ce = *ces[i];
+      if ((ce.id != "int_ne") || !ce[0]->isIntVar() || !ce[1]->isIntVar())
+        continue;
+      IntVar x(iv[ce[0]->getIntVar()]), y(iv[ce[1]->getIntVar()]);
+      if (!x.assigned() && !y.assigned() && (x.varimp() != y.varimp()))
+        g.add(g.add(x),g.add(y),i);
+    }
+    if (g.x.size() < 3)
+      return;
+    // Greedily cover the graph by cliques with at least three nodes
+    std::vector<int> nodes(g.x.size());
+    for (unsigned int i=0; i<nodes.size(); i++)
+      nodes[i] = static_cast<int>(i);
+    NeGraphOrder ngo(g);
+    std::stable_sort(nodes.begin(), nodes.end(), ngo);
+    std::vector<bool> covered(ces.size(), false);
+    for (unsigned int i=0; i<nodes.size(); i++) {
+      while (g.nb[nodes[i]].size() >= 2) {
+        std::vector<int> c(1,nodes[i]);
+        std::vector<int> n(g.nb[nodes[i]].begin(), g.nb[nodes[i]].end());
+        std::stable_sort(n.begin(), n.end(), ngo);
+        for (unsigned int j=0; j<n.size(); j++) {
+          bool all = true;
+          for (unsigned int k=1; all && (k<c.size()); k++)
+            all = (g.nb[n[j]].count(c[k]) > 0);
+          if (all)
+            c.push_back(n[j]);
+        }
+        if (c.size() < 3)
+          break;
+        IntVarArgs x(static_cast<int>(c.size()));
+        for (unsigned int j=0; j<c.size(); j++) {
+          x[static_cast<int>(j)] = g.x[c[j]];
+          for (unsigned int k=j+1; k<c.size(); k++) {
+            std::vector<unsigned int>& e = g.ce[NeGraph::edge(c[j],c[k])];
+            for (unsigned int l=0; l<e.size(); l++)
+              covered[e[l]] = true;
+            g.nb[c[j]].erase(c[k]); g.nb[c[k]].erase(c[j]);
+          }
+        }
+        Gecode::distinct(*this, x, IPL_DEF);
+        _initData->distinct++;
+      }
+    }
+    unsigned int j=0;
+    for (unsigned int i=0; i<ces.size(); i++)
+      if (covered[i])
+        delete ces[i];
+      else
+        ces[j++] = ces[i];
+    ces.resize(j);
+  }
+
+  void
+  FlatZincSpace::postConstraints(std::vector<ConExpr*>& ces) {
+    ConExprOrder ceo;
+    std::sort(ces.begin(), ces.end(), ceo);
+
+    presolveConstraints(ces);
+    detectConstraints(ces);
+    prepareConstraints(ces);
+
+    for (unsigned int i=0; i<ces.size(); i++) {
+      postConstraint(*ces[i]);
       delete ces[i];
       ces[i] = NULL;
     }
   }
 
+  void
+  FlatZincSpace::postConstraint(const ConExpr& ce) {
+    try {
+      registry().post(*this, ce);
+    } catch (Gecode::Exception& e) {
+      throw FlatZinc::Error("Gecode", e.what());
+    } catch (AST::TypeError& e) {
+      throw FlatZinc::Error("Type error", e.what());
+    }
+  }
+
   void flattenAnnotations(AST::Array* ann, std::vector<AST::Node*>& out) {
       for (unsigned int i=0; i<ann->a.size(); i++) {
         if (ann->a[i]->isCall("seq_search")) {
@@ -1033,13 +1423,40 @@ namespace Gecode { namespace FlatZinc {
       }
   }
 
+  namespace {
+    /// Search strategies of the assets in a portfolio
+    enum AssetStrategy {
+      AS_ANN, ///< Search annotation with the requested restarts
+      AS_AFC, ///< Free search by AFC with Luby restarts
+      AS_CHB, ///< Free search by CHB with geometric restarts
+      AS_LNS, ///< Search annotation with LNS and Luby restarts
+      AS_RND  ///< Random free search with Luby restarts
+    };
+
+    /// Return search strategy of asset \a a
+    AssetStrategy assetStrategy(unsigned int a) {
+      if (a == 0U)
+        return AS_ANN;
+      switch (a % 4U) {
+      case 1U: return AS_AFC;
+      case 2U: return AS_CHB;
+      case 3U: return AS_LNS;
+      default: return AS_RND;
+      }
+    }
+
+    /// Percentage of variables to keep in LNS for assets without annotation
+    const unsigned int asset_lns = 70U;
+  }
+
   void
   FlatZincSpace::createBranchers(Printer&p, AST::Node* ann, FlatZincOptions& opt,
                                  bool ignoreUnknown,
                                  std::ostream& err) {
     int seed = opt.seed();
     double decay = opt.decay();
-    Rnd rnd(static_cast<unsigned int>(seed));
+    _branchRandom.seed(static_cast<unsigned int>(seed));
+    Rnd rnd(_branchRandom);
     TieBreak<IntVarBranch> def_int_varsel = INT_VAR_AFC_SIZE_MAX(0.99);
     IntBoolVarBranch def_intbool_varsel = INTBOOL_VAR_AFC_SIZE_MAX(0.99);
     IntValBranch def_int_valsel = INT_VAL_MIN();
@@ -1121,6 +1538,7 @@ namespace Gecode { namespace FlatZinc {
             args = call->getArgs(3);
           }
           _lns = args->a[1]->getInt();
+          _lnsRate = _lns;
           AST::Array *vars = args->a[0]->getArray();
           int k=vars->a.size();
           for (int i=vars->a.size(); i--;)
@@ -1591,6 +2009,103 @@ namespace Gecode { namespace FlatZinc {
       }
     }
 
+    _assetBranchers.clear();
+    // Assets would report the same solutions when asked for several
+    if ((opt.assets() > 1) &&
+        ((_method != SAT) || (opt.solutions() == -1) ||
+         (opt.solutions() == 1))) {
+      // Variables for free search: all but the functionally dependent ones
+      IntVarArgs iva;
+      for (int i=0; i<iv.size(); i++)
+        if (!iv_introduced[2*i+1])
+          iva << iv[i];
+      BoolVarArgs bva;
+      for (int i=0; i<bv.size(); i++)
+        if (!bv_introduced[2*i+1])
+          bva << bv[i];
+#ifdef GECODE_HAS_SET_VARS
+      SetVarArgs sva;
+      for (int i=0; i<sv.size(); i++)
+        if (!sv_introduced[2*i+1])
+          sva << sv[i];
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+      FloatVarArgs fva;
+      for (int i=0; i<fv.size(); i++)
+        if (!fv_introduced[2*i+1])
+          fva << fv[i];
+#endif
+      // LNS assets relax the model variables unless the model says otherwise
+      if ((_method != SAT) && (_lns == 0)) {
+        IntVarArgs lns;
+        for (int i=0; i<iv.size(); i++)
+          if (!iv_introduced[2*i] && !(_optVarIsInt && (_optVar == i)))
+            lns << iv[i];
+        iv_lns = IntVarArray(*this, lns);
+      }
+      for (unsigned int a=0; a<opt.assets(); a++) {
+        AssetStrategy as = assetStrategy(a);
+        if ((as == AS_ANN) || (as == AS_LNS)) {
+          _assetBranchers.push_back(BrancherGroup::all);
+          continue;
+        }
+        // Every asset breaks ties with its own random numbers
+        Rnd r(static_cast<unsigned int>(seed)+a);
+        TieBreak<IntVarBranch> ivb = INT_VAR_RND(r);
+        IntValBranch ivl = INT_VAL_RND(r);
+        TieBreak<BoolVarBranch> bvb = BOOL_VAR_RND(r);
+        BoolValBranch bvl = BOOL_VAL_RND(r);
+#ifdef GECODE_HAS_SET_VARS
+        TieBreak<SetVarBranch> svb = SET_VAR_RND(r);
+        SetValBranch svl = SET_VAL_RND_INC(r);
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+        TieBreak<FloatVarBranch> fvb = FLOAT_VAR_RND(r);
+        FloatValBranch fvl = FLOAT_VAL_SPLIT_RND(r);
+#endif
+        if (as == AS_AFC) {
+          ivb = tiebreak(INT_VAR_AFC_SIZE_MAX(decay), INT_VAR_RND(r));
+          ivl = INT_VAL_MIN();
+          bvb = tiebreak(BOOL_VAR_AFC_MAX(decay), BOOL_VAR_RND(r));
+          bvl = BOOL_VAL_MIN();
+#ifdef GECODE_HAS_SET_VARS
+          svb = tiebreak(SET_VAR_AFC_SIZE_MAX(decay), SET_VAR_RND(r));
+          svl = SET_VAL_MIN_INC();
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+          fvb = tiebreak(FLOAT_VAR_AFC_SIZE_MAX(decay), FLOAT_VAR_RND(r));
+          fvl = FLOAT_VAL_SPLIT_MIN();
+#endif
+        } else if (as == AS_CHB) {
+          ivb = tiebreak(INT_VAR_CHB_SIZE_MAX(), INT_VAR_RND(r));
+          ivl = INT_VAL_SPLIT_MIN();
+          bvb = tiebreak(BOOL_VAR_CHB_MAX(), BOOL_VAR_RND(r));
+          bvl = BOOL_VAL_MIN();
+#ifdef GECODE_HAS_SET_VARS
+          svb = tiebreak(SET_VAR_CHB_SIZE_MAX(), SET_VAR_RND(r));
+          svl = SET_VAL_MIN_INC();
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+          fvb = tiebreak(FLOAT_VAR_CHB_SIZE_MAX(), FLOAT_VAR_RND(r));
+          fvl = FLOAT_VAL_SPLIT_MIN();
+#endif
+        }
+        BrancherGroup bg;
+        if (iva.size() > 0)
+          branch(bg(*this), iva, ivb, ivl);
+        if (bva.size() > 0)
+          branch(bg(*this), bva, bvb, bvl);
+#ifdef GECODE_HAS_SET_VARS
+        if (sva.size() > 0)
+          branch(bg(*this), sva, svb, svl);
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+        if (fva.size() > 0)
+          branch(bg(*this), fva, fvb, fvl);
+#endif
+        _assetBranchers.push_back(bg);
+      }
+    }
   }
 
   AST::Array*
@@ -1727,6 +2242,155 @@ namespace Gecode { namespace FlatZinc {
 
 #endif
 
+#ifdef GECODE_HAS_THREADS
+
+  /// Queue of solutions that are printed by a separate thread
+  class SolutionQueue : public Support::Terminator {
+  protected:
+    /// Maximal number of solutions waiting to be printed
+    static const unsigned int capacity = 64U;
+    /// Stream to print to
+    std::ostream& out;
+    /// Printer for solutions
+    const Printer& p;
+    /// Mutex protecting the queue
+    Support::Mutex m;
+    /// Solutions waiting to be printed
+    std::deque<FlatZincSpace*> q;
+    /// Whether no more solutions will be added
+    bool done;
+    /// Event signalled when a solution has been added or no more will come
+    Support::Event e_put;
+    /// Event signalled when a solution has been printed
+    Support::Event e_get;
+    /// Event signalled when the printing thread has terminated
+    Support::Event e_term;
+  public:
+    /// Initialize for printing to \a out with printer \a p
+    SolutionQueue(std::ostream& out0, const Printer& p0)
+      : out(out0), p(p0), done(false) {}
+    /// Add solution \a s (waits while the queue is full), \a s is deleted after printing
+    void put(FlatZincSpace* s) {
+      while (true) {
+        {
+          Support::Lock l(m);
+          if (q.size() < capacity) {
+            q.push_back(s);
+            break;
+          }
+        }
+        e_get.wait();
+      }
+      e_put.signal();
+    }
+    /// Print solutions until no more solutions will be added
+    void print(void) {
+      while (true) {
+        FlatZincSpace* s = NULL;
+        bool fin;
+        {
+          Support::Lock l(m);
+          if (!q.empty()) {
+            s = q.front(); q.pop_front();
+          }
+          fin = done;
+        }
+        if (s != NULL) {
+          s->print(out, p);
+          out << "----------\n";
+          delete s;
+          e_get.signal();
+        } else if (fin) {
+          break;
+        } else {
+          // Only flush when waiting for further solutions
+          out.flush();
+          e_put.wait();
+        }
+      }
+      out.flush();
+    }
+    /// Wait until all solutions have been printed
+    void finish(void) {
+      {
+        Support::Lock l(m);
+        done = true;
+      }
+      e_put.signal();
+      e_term.wait();
+    }
+    /// The printing thread has terminated
+    virtual void terminated(void) {
+      e_term.signal();
+    }
+  };
+
+  /// Thread printing the solutions of a solution queue
+  class SolutionPrinter : public Support::Runnable {
+  protected:
+    /// The solution queue
+    SolutionQueue& sq;
+  public:
+    /// Initialize for solution queue \a sq0
+    SolutionPrinter(SolutionQueue& sq0) : sq(sq0) {}
+    /// Return the solution queue as terminator
+    virtual Support::Terminator* terminator(void) const {
+      return &sq;
+    }
+    /// Print solutions
+    virtual void run(void) {
+      sq.print();
+    }
+  };
+
+#endif
+
+  /// Builder for search engines of type \a E (used as portfolio assets)
+  template<class T, template<class> class E>
+  class AssetBuilder : public Search::Builder {
+    using Search::Builder::opt;
+  public:
+    /// Initialize with options \a opt
+    AssetBuilder(const Search::Options& opt)
+      : Search::Builder(opt,E<T>::best) {}
+    /// Build the engine
+    virtual Search::Engine* operator() (Space* s) const {
+      return Search::build<T,E>(s,opt);
+    }
+  };
+
+  template<template<class> class Engine>
+  void
+  FlatZincSpace::createAssets(SEBs& sebs, const FlatZincOptions& opt,
+                              const Search::Options& o) {
+    unsigned int scale = opt.restart_scale();
+    for (int a=0; a<sebs.size(); a++) {
+      Search::Options ao(o);
+      // Threads are distributed among the assets by the portfolio
+      ao.threads = 1.0;
+      Search::Cutoff* c = NULL;
+      switch (assetStrategy(static_cast<unsigned int>(a))) {
+      case AS_ANN:
+        c = Driver::createCutoff(opt);
+        break;
+      case AS_CHB:
+        c = Search::Cutoff::geometric(scale,opt.restart_base());
+        break;
+      default:
+        c = Search::Cutoff::luby(scale);
+        break;
+      }
+      if (c == NULL) {
+        ao.cutoff = NULL;
+        sebs[a] = new AssetBuilder<FlatZincSpace,Engine>(ao);
+      } else {
+        ao.cutoff = new Search::CutoffAppend(new Search::CutoffConstant(0),
+                                             1, c);
+        sebs[a] = rbs<FlatZincSpace,Engine>(ao);
+      }
+    }
+  }
+
   template<template<class> class Engine>
   void
   FlatZincSpace::runEngine(std::ostream& out, const Printer& p,
@@ -1832,6 +2496,8 @@ namespace Gecode { namespace FlatZinc {
     unsigned int n_p = 0;
     Support::Timer t_solve;
     t_solve.start();
+    if (opt.profile())
+      profile(true);
     if (status(sstat) != SS_FAILED) {
       n_p = PropagatorGroup::all.size(*this);
     }
@@ -1863,7 +2529,14 @@ namespace Gecode { namespace FlatZinc {
     if (opt.interrupt())
       Driver::CombinedStop::installCtrlHandler(true);
     {
-      Meta<FlatZincSpace,Engine> se(this,o);
+      Search::Base<FlatZincSpace>* se;
+      if (_assetBranchers.size() > 1) {
+        SEBs sebs(static_cast<int>(_assetBranchers.size()));
+        createAssets<Engine>(sebs,opt,o);
+        se = new PBS<FlatZincSpace,Engine>(this,sebs,o);
+      } else {
+        se = new Meta<FlatZincSpace,Engine>(this,o);
+      }
       int noOfSolutions = opt.solutions();
       if (noOfSolutions == -1) {
         noOfSolutions = (_method == SAT) ? 1 : 0;
@@ -1871,35 +2544,60 @@ namespace Gecode { namespace FlatZinc {
       bool printAll = _method == SAT || opt.allSolutions() || noOfSolutions != 0;
       int findSol = noOfSolutions;
       FlatZincSpace* sol = NULL;
-      while (FlatZincSpace* next_sol = se.next()) {
+      bool found = false;
+      bool limit = false;
+#ifdef GECODE_HAS_THREADS
+      // Print solutions in a separate thread while search continues
+      SolutionQueue* sq = NULL;
+      if (printAll) {
+        sq = new SolutionQueue(out, p);
+        Support::Thread::run(new SolutionPrinter(*sq));
+      }
+#endif
+      while (FlatZincSpace* next_sol = se->next()) {
         delete sol;
         sol = next_sol;
+        found = true;
         if (printAll) {
+#ifdef GECODE_HAS_THREADS
+          sq->put(sol);
+          sol = NULL;
+#else
           sol->print(out, p);
           out << "----------" << std::endl;
+#endif
+        }
+        if (--findSol==0) {
+          limit = true;
+          break;
         }
-        if (--findSol==0)
-          goto stopped;
       }
-      if (sol && !printAll) {
-        sol->print(out, p);
-        out << "----------" << std::endl;
+#ifdef GECODE_HAS_THREADS
+      if (sq != NULL) {
+        sq->finish();
+        delete sq;
       }
-      if (!se.stopped()) {
-        if (sol) {
-          out << "==========" << std::endl;
-        } else {
-          out << "=====UNSATISFIABLE=====" << std::endl;
+#endif
+      if (!limit) {
+        if (sol && !printAll) {
+          sol->print(out, p);
+          out << "----------" << std::endl;
+        }
+        if (!se->stopped()) {
+          if (found) {
+            out << "==========" << std::endl;
+          } else {
+            out << "=====UNSATISFIABLE=====" << std::endl;
+          }
+        } else if (!found) {
+            out << "=====UNKNOWN=====" << std::endl;
         }
-      } else if (!sol) {
-          out << "=====UNKNOWN=====" << std::endl;
       }
       delete sol;
-      stopped:
       if (opt.interrupt())
         Driver::CombinedStop::installCtrlHandler(false);
       if (opt.mode() == SM_STAT) {
-        Gecode::Search::Statistics stat = se.statistics();
+        Gecode::Search::Statistics stat = se->statistics();
         double totalTime = (t_total.stop() / 1000.0);
         double solveTime = (t_solve.stop() / 1000.0);
         double initTime = totalTime - solveTime;
@@ -1908,11 +2606,22 @@ namespace Gecode { namespace FlatZinc {
             << std::endl;      
         out << "%%%mzn-stat: solveTime=" << solveTime
             << std::endl;
+        out << "%%%mzn-stat: cpuTime=" << (stat.cpu / 1000.0)
+            << std::endl;
         out << "%%%mzn-stat: solutions="
             << std::abs(noOfSolutions - findSol) << std::endl
             << "%%%mzn-stat: variables="
-            << (intVarCount + boolVarCount + setVarCount) << std::endl
-            << "%%%mzn-stat: propagators=" << n_p << std::endl
+            << (intVarCount + boolVarCount + setVarCount) << std::endl;
+        if (_initData)
+          out << "%%%mzn-stat: aliasedVariables="
+              << _initData->aliases << std::endl
+              << "%%%mzn-stat: duplicateConstraints="
+              << _initData->duplicates << std::endl
+              << "%%%mzn-stat: entailedConstraints="
+              << _initData->entailed << std::endl
+              << "%%%mzn-stat: detectedDistinct="
+              << _initData->distinct << std::endl;
+        out << "%%%mzn-stat: propagators=" << n_p << std::endl
             << "%%%mzn-stat: propagations=" << sstat.propagate+stat.propagate << std::endl
             << "%%%mzn-stat: nodes=" << stat.node << std::endl
             << "%%%mzn-stat: failures=" << stat.fail << std::endl
@@ -1921,6 +2630,12 @@ namespace Gecode { namespace FlatZinc {
             << "%%%mzn-stat-end" << std::endl
             << std::endl;
       }
+      if (opt.profile()) {
+        Gecode::Search::Statistics stat = se->statistics();
+        stat.profile += sstat.profile;
+        Driver::profile(stat, out, "% ");
+      }
+      delete se;
     }
     delete o.stop;
     delete o.tracer;
@@ -1977,6 +2692,12 @@ namespace Gecode { namespace FlatZinc {
     }
   }
 
+  void
+  FlatZincSpace::reseed(unsigned int s) {
+    _random.seed(s);
+    _branchRandom.seed(s);
+  }
+
   void
   FlatZincSpace::constrain(const Space& s) {
     if (_optVarIsInt) {
@@ -1998,28 +2719,138 @@ namespace Gecode { namespace FlatZinc {
     }
   }
 
+  void
+  FlatZincSpace::restartSol(IntVar x, IntVar y) {
+    IntVarArgs xs(iv_restart_sol), ys(iv_restart_val);
+    xs << x; ys << y;
+    iv_restart_sol = IntVarArray(*this, xs);
+    iv_restart_val = IntVarArray(*this, ys);
+  }
+
+  void
+  FlatZincSpace::restartSol(BoolVar x, BoolVar y) {
+    BoolVarArgs xs(bv_restart_sol), ys(bv_restart_val);
+    xs << x; ys << y;
+    bv_restart_sol = BoolVarArray(*this, xs);
+    bv_restart_val = BoolVarArray(*this, ys);
+  }
+
+  void
+  FlatZincSpace::restartUniform(int l, int u, IntVar x) {
+    if (l > u)
+      throw FlatZinc::Error("Gecode", "empty range for uniform random value");
+    IntArgs b(_uniformBounds.size()+2);
+    for (int i=_uniformBounds.size(); i--;)
+      b[i] = _uniformBounds[i];
+    b[_uniformBounds.size()] = l;
+    b[_uniformBounds.size()+1] = u;
+    _uniformBounds = IntSharedArray(b);
+    IntVarArgs xs(iv_restart_uniform);
+    xs << x;
+    iv_restart_uniform = IntVarArray(*this, xs);
+  }
+
+  void
+  FlatZincSpace::restartStatus(IntVar x) {
+    IntVarArgs xs(iv_restart_status);
+    xs << x;
+    iv_restart_status = IntVarArray(*this, xs);
+  }
+
+  bool
+  FlatZincSpace::master(const MetaInfo& mi) {
+    if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) &&
+        (_lns > 0) && (mi.last() != NULL)) {
+      if (mi.solution() > 0) {
+        // The neighbourhood contained a better solution: keep it focused
+        _lnsRate = _lns;
+      } else {
+        // No better solution found: relax more variables next time
+        _lnsRate -= (_lnsRate + 9U) / 10U;
+      }
+    }
+    if ((mi.type() == MetaInfo::PORTFOLIO) && !_assetBranchers.empty()) {
+      // Keep all branchers, the slaves choose their own
+      return true;
+    }
+    return Space::master(mi);
+  }
+
   bool
   FlatZincSpace::slave(const MetaInfo& mi) {
+    if ((mi.type() == MetaInfo::PORTFOLIO) && !_assetBranchers.empty()) {
+      BrancherGroup g = _assetBranchers[mi.asset()];
+      if (g == BrancherGroup::all) {
+        // Keep the branchers for the search annotation
+        for (unsigned int a=0; a<_assetBranchers.size(); a++)
+          if (_assetBranchers[a] != BrancherGroup::all)
+            _assetBranchers[a].kill(*this);
+      } else {
+        // Keep only the free search branchers of this asset
+        BrancherGroup other;
+        for (Branchers b(*this); b(); ++b)
+          if (b.brancher().group() != g)
+            other.move(*this, b.brancher());
+        other.kill(*this);
+      }
+      if ((assetStrategy(mi.asset()) == AS_LNS) && (_lns == 0) &&
+          (iv_lns.size() > 0)) {
+        _lns = _lnsRate = asset_lns;
+      }
+      _assetBranchers.clear();
+      return true;
+    }
+    bool complete = true;
+    if (mi.type() == MetaInfo::RESTART) {
+      // Restart status in the MiniZinc encoding: START, UNKNOWN, or SAT
+      int status = (mi.restart() == 0) ? 1 : ((mi.solution() > 0) ? 4 : 2);
+      for (int i=iv_restart_status.size(); i--;)
+        rel(*this, iv_restart_status[i], IRT_EQ, status);
+      for (int i=iv_restart_uniform.size(); i--;) {
+        int l = _uniformBounds[2*i];
+        unsigned int n =
+          static_cast<unsigned int>(_uniformBounds[2*i+1] - l) + 1U;
+        rel(*this, iv_restart_uniform[i], IRT_EQ,
+            l + static_cast<int>(_random(n)));
+        complete = false;
+      }
+      if (mi.last() != NULL) {
+        const FlatZincSpace& last =
+          static_cast<const FlatZincSpace&>(*mi.last());
+        for (int i=iv_restart_sol.size(); i--;)
+          if (last.iv_restart_sol[i].assigned()) {
+            rel(*this, iv_restart_val[i], IRT_EQ, last.iv_restart_sol[i].val());
+            complete = false;
+          }
+        for (int i=bv_restart_sol.size(); i--;)
+          if (last.bv_restart_sol[i].assigned()) {
+            rel(*this, bv_restart_val[i], IRT_EQ, last.bv_restart_sol[i].val());
+            complete = false;
+          }
+      }
+    }
+    // Once the neighbourhood has grown to all variables, search is complete
     if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) &&
-        (_lns > 0) && (mi.last()==NULL) && (_lnsInitialSolution.size()>0)) {
+        (_lns > 0) && (_lnsRate > 0) &&
+        (mi.last()==NULL) && (_lnsInitialSolution.size()>0)) {
       for (unsigned int i=iv_lns.size(); i--;) {
-        if (_random(99) <= _lns) {
+        if (_random(99) <= _lnsRate) {
           rel(*this, iv_lns[i], IRT_EQ, _lnsInitialSolution[i]);
         }
       }
       return false;
     } else if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) &&
-               (_lns > 0) && mi.last()) {
+               (_lns > 0) && (_lnsRate > 0) && mi.last()) {
       const FlatZincSpace& last =
         static_cast<const FlatZincSpace&>(*mi.last());
       for (unsigned int i=iv_lns.size(); i--;) {
-        if (_random(99) <= _lns) {
+        if (_random(99) <= _lnsRate) {
           rel(*this, iv_lns[i], IRT_EQ, last.iv_lns[i]);
         }
       }
       return false;
     }
-    return true;
+    return complete;
   }
 
   Space*
@@ -2144,6 +2975,27 @@ namespace Gecode { namespace FlatZinc {
     }
     ts.finalize();
 
+    return sharedTupleSet(ts);
+  }
+  TupleSet
+  FlatZincSpace::arg2tupleset(AST::Node* arg, int noOfVars) {
+    if (_initData) {
+      FlatZincSpaceInitData::PreparedTupleSets::iterator it =
+        _initData->preparedTupleSets.find(arg);
+      if (it != _initData->preparedTupleSets.end()) {
+        TupleSet ts = it->second;
+        _initData->preparedTupleSets.erase(it);
+        return sharedTupleSet(ts);
+      }
+    }
+    AST::Array* a = arg->getArray();
+    IntArgs ia(a->a.size());
+    for (int i=a->a.size(); i--;)
+      ia[i] = a->a[i]->isBool() ? a->a[i]->getBool() : a->a[i]->getInt();
+    return arg2tupleset(ia,noOfVars);
+  }
+  TupleSet
+  FlatZincSpace::sharedTupleSet(const TupleSet& ts) {
     if (_initData) {
       FlatZincSpaceInitData::TupleSetSet::iterator it = _initData->tupleSetSet.find(ts);
       if (it != _initData->tupleSetSet.end()) {
@@ -2746,6 +3598,27 @@ namespace Gecode { namespace FlatZinc {
   }
 #endif
 
+  AST::Node*
+  Printer::lookup(const std::string& n) const {
+    for (unsigned int i=0; i<iv_names.size(); i++)
+      if (iv_names[i] == n)
+        return new AST::IntVar(static_cast<int>(i),n);
+    for (unsigned int i=0; i<bv_names.size(); i++)
+      if (bv_names[i] == n)
+        return new AST::BoolVar(static_cast<int>(i),n);
+#ifdef GECODE_HAS_FLOAT_VARS
+    for (unsigned int i=0; i<fv_names.size(); i++)
+      if (fv_names[i] == n)
+        return new AST::FloatVar(static_cast<int>(i),n);
+#endif
+#ifdef GECODE_HAS_SET_VARS
+    for (unsigned int i=0; i<sv_names.size(); i++)
+      if (sv_names[i] == n)
+        return new AST::SetVar(static_cast<int>(i),n);
+#endif
+    return NULL;
+  }
+
   void
   Printer::shrinkElement(AST::Node* node,
                          std::map<int,int>& iv, std::map<int,int>& bv,
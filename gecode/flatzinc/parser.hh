@@ -188,14 +188,14 @@ namespace Gecode { namespace FlatZinc {
     : buf(b.c_str()), pos(0), length(b.size()), fg(fg0),
       hadError(false), err(err0) {}
 
-    ParserState(char* buf0, int length0, std::ostream& err0,
+    ParserState(const char* buf0, size_t length0, std::ostream& err0,
                 Gecode::FlatZinc::FlatZincSpace* fg0)
     : buf(buf0), pos(0), length(length0), fg(fg0),
       hadError(false), err(err0) {}
 
     void* yyscanner;
     const char* buf;
-    unsigned int pos, length;
+    size_t pos, length;
     Gecode::FlatZinc::FlatZincSpace* fg;
     std::vector<std::pair<std::string,AST::Node*> > _output;
 
@@ -218,10 +218,10 @@ namespace Gecode { namespace FlatZinc {
     int fillBuffer(char* lexBuf, unsigned int lexBufSize) {
       if (pos >= length)
         return 0;
-      int num = std::min(length - pos, lexBufSize);
+      size_t num = std::min(length - pos, static_cast<size_t>(lexBufSize));
       memcpy(lexBuf,buf+pos,num);
       pos += num;
-      return num;
+      return static_cast<int>(num);
     }
 
     void output(std::string x, AST::Node* n) {
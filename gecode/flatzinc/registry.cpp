@@ -57,7 +57,7 @@ namespace Gecode { namespace FlatZinc {
 
   void
   Registry::post(FlatZincSpace& s, const ConExpr& ce) {
-    std::map<std::string,poster>::iterator i = r.find(ce.id);
+    std::unordered_map<std::string,poster>::iterator i = r.find(ce.id);
     if (i == r.end()) {
       throw FlatZinc::Error("Registry",
         std::string("Constraint ")+ce.id+" not found");
@@ -1150,48 +1150,42 @@ namespace Gecode { namespace FlatZinc {
     void
     p_table_int(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       IntVarArgs x = s.arg2intvarargs(ce[0]);
-      IntArgs tuples = s.arg2intargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,s.ann2ipl(ann));
     }
 
     void
     p_table_int_reif(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       IntVarArgs x = s.arg2intvarargs(ce[0]);
-      IntArgs tuples = s.arg2intargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_EQV),s.ann2ipl(ann));
     }
 
     void
     p_table_int_imp(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       IntVarArgs x = s.arg2intvarargs(ce[0]);
-      IntArgs tuples = s.arg2intargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_IMP),s.ann2ipl(ann));
     }
     
     void
     p_table_bool(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       BoolVarArgs x = s.arg2boolvarargs(ce[0]);
-      IntArgs tuples = s.arg2boolargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,s.ann2ipl(ann));
     }
 
     void
     p_table_bool_reif(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       BoolVarArgs x = s.arg2boolvarargs(ce[0]);
-      IntArgs tuples = s.arg2boolargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_EQV),s.ann2ipl(ann));
     }
 
     void
     p_table_bool_imp(FlatZincSpace& s, const ConExpr& ce, AST::Node* ann) {
       BoolVarArgs x = s.arg2boolvarargs(ce[0]);
-      IntArgs tuples = s.arg2boolargs(ce[1]);
-      TupleSet ts = s.arg2tupleset(tuples,x.size());
+      TupleSet ts = s.arg2tupleset(ce[1],x.size());
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_IMP),s.ann2ipl(ann));
     }
 
@@ -1455,6 +1449,20 @@ namespace Gecode { namespace FlatZinc {
       member(s,x,y,s.arg2BoolVar(ce[2]),s.ann2ipl(ann));
     }
 
+    void p_int_sol(FlatZincSpace& s, const ConExpr& ce, AST::Node*) {
+      s.restartSol(s.arg2IntVar(ce[0]), s.arg2IntVar(ce[1]));
+    }
+    void p_bool_sol(FlatZincSpace& s, const ConExpr& ce, AST::Node*) {
+      s.restartSol(s.arg2BoolVar(ce[0]), s.arg2BoolVar(ce[1]));
+    }
+    void p_int_uniform(FlatZincSpace& s, const ConExpr& ce, AST::Node*) {
+      s.restartUniform(ce[0]->getInt(), ce[1]->getInt(),
+                       s.arg2IntVar(ce[2]));
+    }
+    void p_status(FlatZincSpace& s, const ConExpr& ce, AST::Node*) {
+      s.restartStatus(s.arg2IntVar(ce[0]));
+    }
+
     class IntPoster {
     public:
       IntPoster(void) {
@@ -1633,6 +1641,13 @@ namespace Gecode { namespace FlatZinc {
         registry().add("gecode_member_int_reif",&p_member_int_reif);
         registry().add("member_bool",&p_member_bool);
         registry().add("gecode_member_bool_reif",&p_member_bool_reif);
+        registry().add("int_sol",&p_int_sol);
+        registry().add("bool_sol",&p_bool_sol);
+        // Only values of solutions are kept, failed runs are discarded
+        registry().add("int_last_val",&p_int_sol);
+        registry().add("bool_last_val",&p_bool_sol);
+        registry().add("int_uniform",&p_int_uniform);
+        registry().add("status",&p_status);
       }
     };
     IntPoster __int_poster;
@@ -36,7 +36,7 @@
 
 #include <gecode/flatzinc.hh>
 #include <string>
-#include <map>
+#include <unordered_map>
 
 namespace Gecode { namespace FlatZinc {
 
@@ -54,7 +54,7 @@ namespace Gecode { namespace FlatZinc {
 
   private:
     /// The actual registry
-    std::map<std::string,poster> r;
+    std::unordered_map<std::string,poster> r;
   };
 
   /// Return global registry object
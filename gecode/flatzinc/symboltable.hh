@@ -74,10 +74,11 @@ namespace Gecode { namespace FlatZinc {
   template<class Val>
   bool
   SymbolTable<Val>::put(const std::string& key, const Val& val) {
-    typename mymap::const_iterator i = m.find(key);
-    bool fresh = (i == m.end());
-    m[key] = val;
-    return fresh;
+    std::pair<typename mymap::iterator,bool> i =
+      m.insert(typename mymap::value_type(key,val));
+    if (!i.second)
+      i.first->second = val;
+    return i.second;
   }
 
   template<class Val>
@@ -4542,6 +4542,184 @@ namespace Gecode {
 
 #include <gecode/int/branch/chb.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Recording conflicts for integer variables
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  class IntConflict : public Conflict {
+  public:
+    /**
+     * \brief Construct as not yet initialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized conflict storage is init or the assignment operator.
+     *
+     */
+    IntConflict(void);
+    /// Copy constructor
+    IntConflict(const IntConflict& c);
+    /// Assignment operator
+    IntConflict& operator =(const IntConflict& c);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * Only the \a k variables most recently in conflict are considered,
+     * all variables are considered if \a k is zero.
+     *
+     * Throws an exception of type IllegalConflict, if \a k is negative.
+     */
+    GECODE_INT_EXPORT
+    IntConflict(Home home, const IntVarArgs& x, int k=1);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * Only the \a k variables most recently in conflict are considered,
+     * all variables are considered if \a k is zero.
+     *
+     * This member function can only be used once and only if the
+     * conflict storage has been constructed with the default constructor.
+     *
+     * Throws an exception of type IllegalConflict, if \a k is negative.
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const IntVarArgs& x, int k=1);
+  };
+
+  /**
+   * \brief Recording conflicts for Boolean variables
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  class BoolConflict : public Conflict {
+  public:
+    /**
+     * \brief Construct as not yet initialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized conflict storage is init or the assignment operator.
+     *
+     */
+    BoolConflict(void);
+    /// Copy constructor
+    BoolConflict(const BoolConflict& c);
+    /// Assignment operator
+    BoolConflict& operator =(const BoolConflict& c);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * Only the \a k variables most recently in conflict are considered,
+     * all variables are considered if \a k is zero.
+     *
+     * Throws an exception of type IllegalConflict, if \a k is negative.
+     */
+    GECODE_INT_EXPORT
+    BoolConflict(Home home, const BoolVarArgs& x, int k=1);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * Only the \a k variables most recently in conflict are considered,
+     * all variables are considered if \a k is zero.
+     *
+     * This member function can only be used once and only if the
+     * conflict storage has been constructed with the default constructor.
+     *
+     * Throws an exception of type IllegalConflict, if \a k is negative.
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const BoolVarArgs& x, int k=1);
+  };
+
+}
+
+#include <gecode/int/branch/conflict.hpp>
+
+namespace Gecode {
+
+  /**
+   * \brief Recording phases for integer variables
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  class IntPhase : public Phase {
+  public:
+    /**
+     * \brief Construct as not yet initialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized phase storage is init or the assignment operator.
+     *
+     */
+    IntPhase(void);
+    /// Copy constructor
+    IntPhase(const IntPhase& p);
+    /// Assignment operator
+    IntPhase& operator =(const IntPhase& p);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * The phase of each variable is initialized with its smallest value.
+     */
+    GECODE_INT_EXPORT
+    IntPhase(Home home, const IntVarArgs& x);
+    /**
+     * \brief Initialize for integer variables \a x
+     *
+     * The phase of each variable is initialized with its smallest value.
+     *
+     * This member function can only be used once and only if the
+     * phase storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const IntVarArgs& x);
+  };
+
+  /**
+   * \brief Recording phases for Boolean variables
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  class BoolPhase : public Phase {
+  public:
+    /**
+     * \brief Construct as not yet initialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized phase storage is init or the assignment operator.
+     *
+     */
+    BoolPhase(void);
+    /// Copy constructor
+    BoolPhase(const BoolPhase& p);
+    /// Assignment operator
+    BoolPhase& operator =(const BoolPhase& p);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * The phase of each variable is initialized with its smallest value.
+     */
+    GECODE_INT_EXPORT
+    BoolPhase(Home home, const BoolVarArgs& x);
+    /**
+     * \brief Initialize for Boolean variables \a x
+     *
+     * The phase of each variable is initialized with its smallest value.
+     *
+     * This member function can only be used once and only if the
+     * phase storage has been constructed with the default constructor.
+     *
+     */
+    GECODE_INT_EXPORT void
+    init(Home home, const BoolVarArgs& x);
+  };
+
+}
+
+#include <gecode/int/branch/phase.hpp>
+
 namespace Gecode {
 
   /// Function type for printing branching alternatives for integer variables
@@ -4620,7 +4798,8 @@ namespace Gecode {
        * The max-regret of a variable is the difference between the
        * largest and second-largest value still in the domain.
        */
-      SEL_REGRET_MAX_MAX
+      SEL_REGRET_MAX_MAX,
+      SEL_CONFLICT         ///< With most recent conflict
     };
   protected:
     /// Which variable to select
@@ -4640,11 +4819,15 @@ namespace Gecode {
     IntVarBranch(Select s, IntAction a, BranchTbl t);
     /// Initialize with selection strategy \a s, CHB \a c, and tie-break limit function \a t
     IntVarBranch(Select s, IntCHB c, BranchTbl t);
+    /// Initialize with selection strategy \a s, \a k conflict variables, and tie-break limit function \a t
+    IntVarBranch(Select s, int k, BranchTbl t);
+    /// Initialize with selection strategy \a s, conflict information \a c, and tie-break limit function \a t
+    IntVarBranch(Select s, IntConflict c, BranchTbl t);
     /// Initialize with selection strategy \a s, branch merit function \a mf, and tie-break limit function \a t
     IntVarBranch(Select s, IntBranchMerit mf, BranchTbl t);
     /// Return selection strategy
     Select select(void) const;
-    /// Expand AFC, action, and CHB
+    /// Expand AFC, action, CHB, and conflict information
     void expand(Home home, const IntVarArgs& x);
   };
 
@@ -4668,7 +4851,8 @@ namespace Gecode {
       SEL_ACTION_MIN,      ///< With lowest action
       SEL_ACTION_MAX,      ///< With highest action
       SEL_CHB_MIN,         ///< With lowest CHB
-      SEL_CHB_MAX          ///< With highest CHB
+      SEL_CHB_MAX,         ///< With highest CHB
+      SEL_CONFLICT         ///< With most recent conflict
     };
   protected:
     /// Which variable to select
@@ -4688,6 +4872,10 @@ namespace Gecode {
     BoolVarBranch(Select s, BoolAction a, BranchTbl t);
     /// Initialize with selection strategy \a s, CHB \a c, and tie-break limit function \a t
     BoolVarBranch(Select s, BoolCHB c, BranchTbl t);
+    /// Initialize with selection strategy \a s, \a k conflict variables, and tie-break limit function \a t
+    BoolVarBranch(Select s, int k, BranchTbl t);
+    /// Initialize with selection strategy \a s, conflict information \a c, and tie-break limit function \a t
+    BoolVarBranch(Select s, BoolConflict c, BranchTbl t);
     /// Initialize with selection strategy \a s, branch merit function \a mf, and tie-break limit function \a t
     BoolVarBranch(Select s, BoolBranchMerit mf, BranchTbl t);
     /// Return selection strategy
@@ -4801,6 +4989,29 @@ namespace Gecode {
    * largest and second-largest value still in the domain.
    */
   IntVarBranch INT_VAR_REGRET_MAX_MAX(BranchTbl tbl=nullptr);
+  /**
+   * \brief Select variable with most recent conflict among the \a k variables most recently in conflict (last-conflict reasoning)
+   *
+   * A variable is in conflict if search fails after the variable has
+   * been branched on. All variables that are not among the \a k
+   * variables most recently in conflict have no merit, hence the
+   * selection is intended to be used with tie-breaking, for example
+   * \code tiebreak(INT_VAR_LAST_CONFLICT(2),INT_VAR_SIZE_MIN()) \endcode
+   * tries the two variables most recently in conflict first and selects
+   * a variable with smallest domain otherwise.
+   *
+   * Throws an exception of type IllegalConflict, if \a k is negative.
+   */
+  IntVarBranch INT_VAR_LAST_CONFLICT(int k=1, BranchTbl tbl=nullptr);
+  /// Select variable with most recent conflict as recorded by \a c
+  IntVarBranch INT_VAR_LAST_CONFLICT(IntConflict c, BranchTbl tbl=nullptr);
+  /**
+   * \brief Select variable with most recent conflict (conflict-ordering search)
+   *
+   * Same as INT_VAR_LAST_CONFLICT(0), that is, all variables that have
+   * been in conflict are ordered by their most recent conflict.
+   */
+  IntVarBranch INT_VAR_CONFLICT_ORDER(BranchTbl tbl=nullptr);
 
   /// Select first unassigned variable
   BoolVarBranch BOOL_VAR_NONE(void);
@@ -4838,6 +5049,19 @@ namespace Gecode {
   BoolVarBranch BOOL_VAR_CHB_MAX(BoolCHB c, BranchTbl tbl=nullptr);
   /// Select variable with largest CHB Q-score
   BoolVarBranch BOOL_VAR_CHB_MAX(BranchTbl tbl=nullptr);
+  /**
+   * \brief Select variable with most recent conflict among the \a k variables most recently in conflict (last-conflict reasoning)
+   *
+   * The selection is intended to be used with tie-breaking, see
+   * INT_VAR_LAST_CONFLICT.
+   *
+   * Throws an exception of type IllegalConflict, if \a k is negative.
+   */
+  BoolVarBranch BOOL_VAR_LAST_CONFLICT(int k=1, BranchTbl tbl=nullptr);
+  /// Select variable with most recent conflict as recorded by \a c
+  BoolVarBranch BOOL_VAR_LAST_CONFLICT(BoolConflict c, BranchTbl tbl=nullptr);
+  /// Select variable with most recent conflict (conflict-ordering search)
+  BoolVarBranch BOOL_VAR_CONFLICT_ORDER(BranchTbl tbl=nullptr);
   //@}
 
 }
@@ -4863,6 +5087,7 @@ namespace Gecode {
       SEL_SPLIT_MAX,  ///< Select values greater than mean of smallest and largest value
       SEL_RANGE_MIN,  ///< Select the smallest range of the variable domain if it has several ranges, otherwise select values not greater than mean of smallest and largest value
       SEL_RANGE_MAX,  ///< Select the largest range of the variable domain if it has several ranges, otherwise select values greater than mean of smallest and largest value
+      SEL_PHASE,      ///< Select value the variable has been assigned to most recently
       SEL_VAL_COMMIT, ///< Select value according to user-defined functions
       SEL_VALUES_MIN, ///< Select all values starting from smallest
       SEL_VALUES_MAX  ///< Select all values starting from largest
@@ -4877,8 +5102,12 @@ namespace Gecode {
     IntValBranch(Rnd r);
     /// Initialize with value function \a f and commit function \a c
     IntValBranch(IntBranchVal v, IntBranchCommit c);
+    /// Initialize with phase information \a p
+    IntValBranch(IntPhase p);
     /// Return selection strategy
     Select select(void) const;
+    /// Create phase information for variables \a x if needed
+    void expand(Home home, const IntVarArgs& x);
   };
 
   /**
@@ -4893,6 +5122,7 @@ namespace Gecode {
       SEL_MIN,       ///< Select smallest value
       SEL_MAX,       ///< Select largest value
       SEL_RND,       ///< Select random value
+      SEL_PHASE,     ///< Select value the variable has been assigned to most recently
       SEL_VAL_COMMIT ///< Select value according to user-defined functions
    };
   protected:
@@ -4905,8 +5135,12 @@ namespace Gecode {
     BoolValBranch(Rnd r);
     /// Initialize with value function \a f and commit function \a c
     BoolValBranch(BoolBranchVal v, BoolBranchCommit c);
+    /// Initialize with phase information \a p
+    BoolValBranch(BoolPhase p);
     /// Return selection strategy
     Select select(void) const;
+    /// Create phase information for variables \a x if needed
+    void expand(Home home, const BoolVarArgs& x);
   };
 
   /**
@@ -4930,6 +5164,18 @@ namespace Gecode {
   IntValBranch INT_VAL_RANGE_MIN(void);
   /// Select the largest range of the variable domain if it has several ranges, otherwise select values greater than mean of smallest and largest value
   IntValBranch INT_VAL_RANGE_MAX(void);
+  /**
+   * \brief Select value the variable has been assigned to most recently
+   *
+   * Selects the smallest value if the most recent value is not in the
+   * domain. The phases are recorded for the variables branched on and
+   * are shared by all clones and hence also across restarts. In
+   * particular, after a solution has been found, the values of the
+   * solution are tried first (solution-guided search).
+   */
+  IntValBranch INT_VAL_PHASE(void);
+  /// Select value as recorded by phase information \a p
+  IntValBranch INT_VAL_PHASE(IntPhase p);
   /**
    * \brief Select value as defined by the value function \a v and commit function \a c
    * Uses a commit function as default that posts the constraints that
@@ -4948,6 +5194,16 @@ namespace Gecode {
   BoolValBranch BOOL_VAL_MAX(void);
   /// Select random value
   BoolValBranch BOOL_VAL_RND(Rnd r);
+  /**
+   * \brief Select value the variable has been assigned to most recently
+   *
+   * Selects the smallest value if the most recent value is not in the
+   * domain. The phases are recorded for the variables branched on and
+   * are shared by all clones and hence also across restarts.
+   */
+  BoolValBranch BOOL_VAL_PHASE(void);
+  /// Select value as recorded by phase information \a p
+  BoolValBranch BOOL_VAL_PHASE(BoolPhase p);
   /**
    * \brief Select value as defined by the value function \a v and commit function \a c
    * Uses a commit function as default that posts the constraints that
@@ -5403,6 +5659,84 @@ namespace Gecode {
          BoolBranchFilter bf=nullptr,
          BoolVarValPrint vvp=nullptr);
 
+  /**
+   * \brief Branch over \a x with variable selection \a vars and value
+   * selection \a vals with symmetry breaking by dominance detection
+   *
+   * The brancher records for each explored left alternative a nogood
+   * consisting of the decisions leading to it. A node is pruned as soon
+   * as one of the symmetries \a syms maps a nogood to literals that are
+   * all entailed. Each symmetry in \a syms is used on its own, that is,
+   * compositions of different symmetries are not detected. In contrast
+   * to LDSB the symmetries must be symmetries of the whole problem and
+   * the brancher should be the first brancher posted. Any search engine
+   * can be used.
+   *
+   * Throws LDSBBadValueSelection exception if \a vals is any of
+   * SEL_SPLIT_MIN, SEL_SPLIT_MAX, SEL_RANGE_MIN, SEL_RANGE_MAX,
+   * SEL_VALUES_MIN, and SEL_VALUES_MAX, or if \a vals is
+   * SEL_VAL_COMMIT with a custom commit function.
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  GECODE_INT_EXPORT void
+  sbdd(Home home, const IntVarArgs& x,
+       IntVarBranch vars, IntValBranch vals,
+       const Symmetries& syms,
+       IntBranchFilter bf=nullptr,
+       IntVarValPrint vvp=nullptr);
+  /**
+   * \brief Branch over \a x with variable selection \a vars and value
+   * selection \a vals with symmetry breaking by dominance detection
+   *
+   * See the integer variant for details.
+   *
+   * Throws LDSBBadValueSelection exception if \a vals is
+   * SEL_VAL_COMMIT with a custom commit function.
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  GECODE_INT_EXPORT void
+  sbdd(Home home, const BoolVarArgs& x,
+       BoolVarBranch vars, BoolValBranch vals,
+       const Symmetries& syms,
+       BoolBranchFilter bf=nullptr,
+       BoolVarValPrint vvp=nullptr);
+
+  /**
+   * \brief Branch over \a x by singleton lookahead
+   *
+   * For each unassigned variable and each value in its domain the
+   * brancher propagates a clone of the space where the variable is
+   * assigned to the value (a probe). Values for which the probe fails
+   * are removed (as singleton arc consistency does). Otherwise the
+   * brancher selects the variable whose probes leave the smallest
+   * search space and the value whose probe leaves the largest search
+   * space, and creates a choice with alternatives \f$x=n\f$ and
+   * \f$x\neq n\f$.
+   *
+   * As probing is expensive, the brancher only creates \a depth such
+   * choices on each path and is done afterwards, so that further
+   * branchers can be posted for the remaining search. The probes are
+   * run by \a threads threads (if Gecode has been compiled with thread
+   * support).
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  GECODE_INT_EXPORT void
+  lookahead(Home home, const IntVarArgs& x, unsigned int depth,
+            unsigned int threads=1U);
+  /**
+   * \brief Branch over \a x by singleton lookahead
+   *
+   * See the integer variant for details.
+   *
+   * \ingroup TaskModelIntBranch
+   */
+  GECODE_INT_EXPORT void
+  lookahead(Home home, const BoolVarArgs& x, unsigned int depth,
+            unsigned int threads=1U);
+
 #ifdef GECODE_HAS_CBS
 
   /**
@@ -43,6 +43,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.expand(home,x);
+    vals.expand(home,x);
     ViewArray<IntView> xv(home,x);
     ViewSel<IntView>* vs[1] = {
       Branch::viewsel(home,vars)
@@ -69,6 +70,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.a.expand(home,x);
+    vals.expand(home,x);
     if ((vars.a.select() == IntVarBranch::SEL_NONE) ||
         (vars.a.select() == IntVarBranch::SEL_RND))
       vars.b = INT_VAR_NONE();
@@ -221,6 +223,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.expand(home,x);
+    vals.expand(home,x);
     ViewArray<BoolView> xv(home,x);
     ViewSel<BoolView>* vs[1] = {
       Branch::viewsel(home,vars)
@@ -237,6 +240,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.a.expand(home,x);
+    vals.expand(home,x);
     if ((vars.a.select() == BoolVarBranch::SEL_NONE) ||
         (vars.a.select() == BoolVarBranch::SEL_RND))
       vars.b = BOOL_VAR_NONE();
@@ -350,6 +354,26 @@ namespace Gecode {
     assign(home, xv, BOOL_VAR_NONE(), ba, nullptr, vvp);
   }
 
+  void
+  lookahead(Home home, const IntVarArgs& x, unsigned int depth,
+            unsigned int threads) {
+    using namespace Int;
+    if (home.failed() || (depth == 0U)) return;
+    ViewArray<IntView> y(home,x);
+    Branch::LookaheadBrancher<IntView>::post(home,y,depth,
+                                             std::max(threads,1U));
+  }
+
+  void
+  lookahead(Home home, const BoolVarArgs& x, unsigned int depth,
+            unsigned int threads) {
+    using namespace Int;
+    if (home.failed() || (depth == 0U)) return;
+    ViewArray<BoolView> y(home,x);
+    Branch::LookaheadBrancher<BoolView>::post(home,y,depth,
+                                              std::max(threads,1U));
+  }
+
 #ifdef GECODE_HAS_CBS
 
   void
@@ -368,6 +368,34 @@ namespace Gecode { namespace Int { namespace Branch {
     void dispose(Space& home);
   };
 
+  /**
+   * \brief Value selection class for phase of view
+   *
+   * Selects the value the view has been assigned to most recently if
+   * it is still in the domain, and the smallest value otherwise.
+   *
+   * Requires \code #include <gecode/int/branch.hh> \endcode
+   * \ingroup FuncIntValSel
+   */
+  template<class View>
+  class ValSelPhase : public ValSel<View,int> {
+    using typename ValSel<View,int>::Var;
+  protected:
+    /// The phase information
+    Phase p;
+  public:
+    /// Constructor for initialization
+    ValSelPhase(Space& home, const ValBranch<Var>& vb);
+    /// Constructor for cloning
+    ValSelPhase(Space& home, ValSelPhase& vs);
+    /// Return value of view \a x at position \a i
+    int val(const Space& home, View x, int i);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Delete value selection
+    void dispose(Space& home);
+  };
+
   /**
    * \brief Value selection class for minimum range of integer view
    *
@@ -676,6 +704,158 @@ namespace Gecode { namespace Int { namespace Branch {
 
 #include <gecode/int/branch/view-values.hpp>
 
+namespace Gecode { namespace Int { namespace Branch {
+
+  /**
+   * \brief %Choice for lookahead brancher
+   *
+   * Stores pairs of positions and values. A choice with a single
+   * alternative removes all values from the views at the positions,
+   * a choice with two alternatives assigns the view at the first
+   * position to the first value (first alternative) or removes the
+   * value (second alternative).
+   */
+  class GECODE_VTABLE_EXPORT LookaheadChoice : public Choice {
+  protected:
+    /// Number of pairs
+    int n;
+    /// Positions
+    int* p;
+    /// Values
+    int* v;
+  public:
+    /// Initialize choice for brancher \a b with \a a alternatives and \a n pairs
+    LookaheadChoice(const Brancher& b, unsigned int a, int n);
+    /// Return number of pairs
+    int size(void) const;
+    /// Return position of pair \a i
+    int& pos(int i);
+    /// Return position of pair \a i
+    int pos(int i) const;
+    /// Return value of pair \a i
+    int& val(int i);
+    /// Return value of pair \a i
+    int val(int i) const;
+    /// Archive into \a e
+    virtual void archive(Archive& e) const;
+    /// Destructor
+    virtual ~LookaheadChoice(void);
+  };
+
+  /**
+   * \brief %Brancher by singleton lookahead
+   *
+   * For each unassigned view and each value in its domain, the
+   * brancher clones the space, assigns the view to the value in the
+   * clone and propagates the clone (a probe). Values whose probe fails
+   * are removed by a choice with a single alternative. Otherwise the
+   * brancher selects the view for which the probes leave the smallest
+   * search space (summed over all values) and the value whose probe
+   * leaves the largest search space. The search space is measured
+   * as the product of the domain sizes of the views.
+   *
+   * The brancher only creates \a depth choices with two alternatives
+   * on a path, after that it is done. Probes can be run in parallel
+   * by several threads.
+   */
+  template<class View>
+  class LookaheadBrancher : public Brancher {
+  protected:
+    /// Views to branch on
+    ViewArray<View> x;
+    /// Unassigned views start at x[start]
+    mutable int start;
+    /// Number of choices with two alternatives committed on the path
+    unsigned int d;
+    /// Maximal number of choices with two alternatives on a path
+    unsigned int depth;
+    /// Number of threads to run probes
+    unsigned int threads;
+    /// Brancher created by the last copy during probing
+    LookaheadBrancher* c;
+    /// Result of a probe
+    class ProbeResult {
+    public:
+      /// Index of probe
+      int j;
+      /// Whether the probe failed
+      bool failed;
+      /// Logarithm of the remaining search space
+      double size;
+    };
+    /// A single probe on a clone
+    class Probe : public Support::Job<ProbeResult> {
+    protected:
+      /// The clone
+      Space* s;
+      /// The brancher in the clone
+      LookaheadBrancher& b;
+      /// Position of view
+      int i;
+      /// Value to probe
+      int n;
+      /// Index of probe
+      int j;
+    public:
+      /// Initialize
+      Probe(Space* s, LookaheadBrancher& b, int i, int n, int j);
+      /// Run probe
+      virtual ProbeResult run(int);
+    };
+    /// Iterator over probes
+    class Probes {
+    protected:
+      /// The space to clone
+      Space& home;
+      /// The brancher
+      LookaheadBrancher& b;
+      /// Positions
+      const int* p;
+      /// Values
+      const int* v;
+      /// Number of probes
+      int n;
+      /// Current probe
+      int j;
+    public:
+      /// Initialize
+      Probes(Space& home, LookaheadBrancher& b,
+             const int* p, const int* v, int n);
+      /// Test whether there are probes left
+      bool operator ()(void) const;
+      /// Return next probe
+      Probe* job(void);
+    };
+    /// Return logarithm of the search space for the views
+    double size(void) const;
+    /// Constructor for cloning \a b
+    LookaheadBrancher(Space& home, LookaheadBrancher& b);
+    /// Constructor for creation
+    LookaheadBrancher(Home home, ViewArray<View>& x,
+                      unsigned int depth, unsigned int threads);
+  public:
+    /// Check status of brancher, return true if alternatives left
+    virtual bool status(const Space& home) const;
+    /// Return choice
+    virtual const Choice* choice(Space& home);
+    /// Return choice
+    virtual const Choice* choice(const Space& home, Archive& e);
+    /// Perform commit for choice \a c and alternative \a a
+    virtual ExecStatus commit(Space& home, const Choice& c, unsigned int a);
+    /// Print on \a o the alternative \a a of choice \a c
+    virtual void print(const Space& home, const Choice& c, unsigned int a,
+                       std::ostream& o) const;
+    /// Perform cloning
+    virtual Actor* copy(Space& home);
+    /// Post brancher
+    static void post(Home home, ViewArray<View>& x,
+                     unsigned int depth, unsigned int threads);
+  };
+
+}}}
+
+#include <gecode/int/branch/lookahead.hpp>
+
 #ifdef GECODE_HAS_CBS
 
 namespace Gecode { namespace Int { namespace Branch {
@@ -0,0 +1,316 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <cmath>
+
+namespace Gecode { namespace Int { namespace Branch {
+
+  /*
+   * Choice
+   *
+   */
+  forceinline
+  LookaheadChoice::LookaheadChoice(const Brancher& b, unsigned int a,
+                                   int n0)
+    : Choice(b,a), n(n0),
+      p(heap.alloc<int>(n0)), v(heap.alloc<int>(n0)) {}
+  forceinline int
+  LookaheadChoice::size(void) const {
+    return n;
+  }
+  forceinline int&
+  LookaheadChoice::pos(int i) {
+    return p[i];
+  }
+  forceinline int
+  LookaheadChoice::pos(int i) const {
+    return p[i];
+  }
+  forceinline int&
+  LookaheadChoice::val(int i) {
+    return v[i];
+  }
+  forceinline int
+  LookaheadChoice::val(int i) const {
+    return v[i];
+  }
+  forceinline void
+  LookaheadChoice::archive(Archive& e) const {
+    Choice::archive(e);
+    e << alternatives() << n;
+    for (int i=0; i<n; i++)
+      e << p[i] << v[i];
+  }
+  forceinline
+  LookaheadChoice::~LookaheadChoice(void) {
+    heap.free<int>(p,n);
+    heap.free<int>(v,n);
+  }
+
+
+  /*
+   * Probes
+   *
+   */
+  template<class View>
+  forceinline
+  LookaheadBrancher<View>::Probe::Probe(Space* s0, LookaheadBrancher& b0,
+                                        int i0, int n0, int j0)
+    : s(s0), b(b0), i(i0), n(n0), j(j0) {}
+
+  template<class View>
+  typename LookaheadBrancher<View>::ProbeResult
+  LookaheadBrancher<View>::Probe::run(int) {
+    ProbeResult r;
+    r.j = j;
+    if (me_failed(b.x[i].eq(*s,n)) || (s->status() == SS_FAILED)) {
+      r.failed = true; r.size = 0.0;
+    } else {
+      r.failed = false; r.size = b.size();
+    }
+    delete s;
+    return r;
+  }
+
+  template<class View>
+  forceinline
+  LookaheadBrancher<View>::Probes::Probes(Space& home0,
+                                          LookaheadBrancher& b0,
+                                          const int* p0, const int* v0,
+                                          int n0)
+    : home(home0), b(b0), p(p0), v(v0), n(n0), j(0) {}
+
+  template<class View>
+  forceinline bool
+  LookaheadBrancher<View>::Probes::operator ()(void) const {
+    return j < n;
+  }
+
+  template<class View>
+  typename LookaheadBrancher<View>::Probe*
+  LookaheadBrancher<View>::Probes::job(void) {
+    // The copy constructor of the brancher in the clone sets b.c
+    b.c = NULL;
+    Space* s = home.clone();
+    assert(b.c != NULL);
+    Probe* pr = new Probe(s,*b.c,p[j],v[j],j);
+    j++;
+    return pr;
+  }
+
+
+  /*
+   * Brancher
+   *
+   */
+  template<class View>
+  forceinline
+  LookaheadBrancher<View>::LookaheadBrancher(Home home, ViewArray<View>& x0,
+                                             unsigned int depth0,
+                                             unsigned int threads0)
+    : Brancher(home), x(x0), start(0), d(0U),
+      depth(depth0), threads(threads0), c(NULL) {}
+
+  template<class View>
+  forceinline
+  LookaheadBrancher<View>::LookaheadBrancher(Space& home,
+                                             LookaheadBrancher& b)
+    : Brancher(home,b), start(b.start), d(b.d),
+      depth(b.depth), threads(b.threads), c(NULL) {
+    x.update(home,b.x);
+    b.c = this;
+  }
+
+  template<class View>
+  void
+  LookaheadBrancher<View>::post(Home home, ViewArray<View>& x,
+                                unsigned int depth, unsigned int threads) {
+    (void) new (home) LookaheadBrancher(home,x,depth,threads);
+  }
+
+  template<class View>
+  Actor*
+  LookaheadBrancher<View>::copy(Space& home) {
+    return new (home) LookaheadBrancher(home,*this);
+  }
+
+  template<class View>
+  double
+  LookaheadBrancher<View>::size(void) const {
+    double s = 0.0;
+    for (int i=0; i<x.size(); i++)
+      s += log(static_cast<double>(x[i].size()));
+    return s;
+  }
+
+  template<class View>
+  bool
+  LookaheadBrancher<View>::status(const Space&) const {
+    if (d >= depth)
+      return false;
+    for (int i=start; i < x.size(); i++)
+      if (!x[i].assigned()) {
+        start = i;
+        return true;
+      }
+    return false;
+  }
+
+  template<class View>
+  const Choice*
+  LookaheadBrancher<View>::choice(Space& home) {
+    Region r;
+    // Collect probes, grouped by view
+    int n = 0;
+    for (int i=start; i<x.size(); i++)
+      if (!x[i].assigned())
+        n += static_cast<int>(x[i].size());
+    int* p = r.alloc<int>(n);
+    int* v = r.alloc<int>(n);
+    {
+      int j = 0;
+      for (int i=start; i<x.size(); i++)
+        if (!x[i].assigned())
+          for (ViewValues<View> vv(x[i]); vv(); ++vv) {
+            p[j] = i; v[j] = vv.val(); j++;
+          }
+      assert(j == n);
+    }
+
+    // Run probes
+    ProbeResult* pr = r.alloc<ProbeResult>(n);
+    Probes ps(home,*this,p,v,n);
+#ifdef GECODE_HAS_THREADS
+    if (threads > 1) {
+      Support::RunJobs<Probes,ProbeResult> rj(ps,threads);
+      ProbeResult res;
+      while (rj.run(res))
+        pr[res.j] = res;
+    } else
+#endif
+    {
+      while (ps()) {
+        Probe* j = ps.job();
+        ProbeResult res = j->run(0);
+        pr[res.j] = res;
+        delete j;
+      }
+    }
+
+    // Values with failed probes are removed
+    int n_f = 0;
+    for (int j=0; j<n; j++)
+      if (pr[j].failed)
+        n_f++;
+    if (n_f > 0) {
+      LookaheadChoice* lc = new LookaheadChoice(*this,1,n_f);
+      for (int j=0, k=0; j<n; j++)
+        if (pr[j].failed) {
+          lc->pos(k) = p[j]; lc->val(k) = v[j]; k++;
+        }
+      return lc;
+    }
+
+    // Select the view with the smallest search space left
+    double s0 = size();
+    int b_i = -1, b_v = 0;
+    double b_s = 0.0;
+    for (int j=0; j<n; ) {
+      int i = p[j];
+      int i_v = v[j];
+      double i_s = 0.0, m = pr[j].size;
+      for (; (j<n) && (p[j] == i); j++) {
+        i_s += exp(pr[j].size - s0);
+        if (pr[j].size > m) {
+          m = pr[j].size; i_v = v[j];
+        }
+      }
+      if ((b_i < 0) || (i_s < b_s)) {
+        b_i = i; b_v = i_v; b_s = i_s;
+      }
+    }
+    LookaheadChoice* lc = new LookaheadChoice(*this,2,1);
+    lc->pos(0) = b_i; lc->val(0) = b_v;
+    return lc;
+  }
+
+  template<class View>
+  const Choice*
+  LookaheadBrancher<View>::choice(const Space&, Archive& e) {
+    unsigned int a; int n;
+    e >> a >> n;
+    LookaheadChoice* lc = new LookaheadChoice(*this,a,n);
+    for (int i=0; i<n; i++)
+      e >> lc->pos(i) >> lc->val(i);
+    return lc;
+  }
+
+  template<class View>
+  ExecStatus
+  LookaheadBrancher<View>::commit(Space& home, const Choice& c,
+                                  unsigned int a) {
+    const LookaheadChoice& lc = static_cast<const LookaheadChoice&>(c);
+    if (lc.alternatives() == 1) {
+      for (int i=0; i<lc.size(); i++)
+        GECODE_ME_CHECK(x[lc.pos(i)].nq(home,lc.val(i)));
+      return ES_OK;
+    }
+    d++;
+    if (a == 0)
+      return me_failed(x[lc.pos(0)].eq(home,lc.val(0))) ? ES_FAILED : ES_OK;
+    else
+      return me_failed(x[lc.pos(0)].nq(home,lc.val(0))) ? ES_FAILED : ES_OK;
+  }
+
+  template<class View>
+  void
+  LookaheadBrancher<View>::print(const Space&, const Choice& c,
+                                 unsigned int a,
+                                 std::ostream& o) const {
+    const LookaheadChoice& lc = static_cast<const LookaheadChoice&>(c);
+    if (lc.alternatives() == 1) {
+      for (int i=0; i<lc.size(); i++) {
+        if (i > 0)
+          o << ", ";
+        o << "x[" << lc.pos(i) << "] != " << lc.val(i);
+      }
+    } else if (a == 0) {
+      o << "x[" << lc.pos(0) << "] = " << lc.val(0);
+    } else {
+      o << "x[" << lc.pos(0) << "] != " << lc.val(0);
+    }
+  }
+
+}}}
+
+// STATISTICS: int-branch
@@ -64,6 +64,9 @@ namespace Gecode { namespace Int { namespace Branch {
     case IntValBranch::SEL_RANGE_MAX:
       return new (home)
         ValSelCommit<ValSelRangeMax,ValCommitGq<IntView> >(home,ivb);
+    case IntValBranch::SEL_PHASE:
+      return new (home)
+        ValSelCommit<ValSelPhase<IntView>,ValCommitEq<IntView> >(home,ivb);
     case IntValBranch::SEL_VAL_COMMIT:
       if (!ivb.commit()) {
         return new (home)
@@ -117,6 +120,9 @@ namespace Gecode { namespace Int { namespace Branch {
     case BoolValBranch::SEL_RND:
       return new (home)
         ValSelCommit<ValSelRnd<BoolView>,ValCommitEq<BoolView> >(home,bvb);
+    case BoolValBranch::SEL_PHASE:
+      return new (home)
+        ValSelCommit<ValSelPhase<BoolView>,ValCommitEq<BoolView> >(home,bvb);
     case BoolValBranch::SEL_VAL_COMMIT:
       if (!bvb.commit()) {
         return new (home)
@@ -126,6 +126,33 @@ namespace Gecode { namespace Int { namespace Branch {
     r.~Rnd();
   }
 
+  template<class View>
+  forceinline
+  ValSelPhase<View>::ValSelPhase
+  (Space& home, const ValBranch<ValSelPhase<View>::Var>& vb)
+    : ValSel<View,int>(home,vb), p(vb.phase()) {}
+  template<class View>
+  forceinline
+  ValSelPhase<View>::ValSelPhase(Space& home, ValSelPhase& vs)
+    : ValSel<View,int>(home,vs), p(vs.p) {
+  }
+  template<class View>
+  forceinline int
+  ValSelPhase<View>::val(const Space&, View x, int i) {
+    int v = p[i];
+    return x.in(v) ? v : x.min();
+  }
+  template<class View>
+  forceinline bool
+  ValSelPhase<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  ValSelPhase<View>::dispose(Space&) {
+    p.~Phase();
+  }
+
   forceinline
   ValSelRangeMin::ValSelRangeMin
   (Space& home, const ValBranch<IntVar>& vb)
@@ -45,11 +45,21 @@ namespace Gecode {
   IntValBranch::IntValBranch(IntBranchVal v, IntBranchCommit c)
     : ValBranch<IntVar>(v,c), s(SEL_VAL_COMMIT) {}
 
+  forceinline
+  IntValBranch::IntValBranch(IntPhase p)
+    : ValBranch<IntVar>(p), s(SEL_PHASE) {}
+
   forceinline IntValBranch::Select
   IntValBranch::select(void) const {
     return s;
   }
 
+  forceinline void
+  IntValBranch::expand(Home home, const IntVarArgs& x) {
+    if ((select() == SEL_PHASE) && !_ph)
+      _ph = IntPhase(home,x);
+  }
+
 
   inline IntValBranch
   INT_VAL_MIN(void) {
@@ -91,6 +101,16 @@ namespace Gecode {
     return IntValBranch(IntValBranch::SEL_RANGE_MAX);
   }
 
+  inline IntValBranch
+  INT_VAL_PHASE(void) {
+    return IntValBranch(IntValBranch::SEL_PHASE);
+  }
+
+  inline IntValBranch
+  INT_VAL_PHASE(IntPhase p) {
+    return IntValBranch(p);
+  }
+
   inline IntValBranch
   INT_VAL(IntBranchVal v, IntBranchCommit c) {
     return IntValBranch(v,c);
@@ -120,11 +140,21 @@ namespace Gecode {
   BoolValBranch::BoolValBranch(BoolBranchVal v, BoolBranchCommit c)
     : ValBranch<BoolVar>(v,c), s(SEL_VAL_COMMIT) {}
 
+  forceinline
+  BoolValBranch::BoolValBranch(BoolPhase p)
+    : ValBranch<BoolVar>(p), s(SEL_PHASE) {}
+
   forceinline BoolValBranch::Select
   BoolValBranch::select(void) const {
     return s;
   }
 
+  forceinline void
+  BoolValBranch::expand(Home home, const BoolVarArgs& x) {
+    if ((select() == SEL_PHASE) && !_ph)
+      _ph = BoolPhase(home,x);
+  }
+
 
   inline BoolValBranch
   BOOL_VAL_MIN(void) {
@@ -141,6 +171,16 @@ namespace Gecode {
     return BoolValBranch(r);
   }
 
+  inline BoolValBranch
+  BOOL_VAL_PHASE(void) {
+    return BoolValBranch(BoolValBranch::SEL_PHASE);
+  }
+
+  inline BoolValBranch
+  BOOL_VAL_PHASE(BoolPhase p) {
+    return BoolValBranch(p);
+  }
+
   inline BoolValBranch
   BOOL_VAL(BoolBranchVal v, BoolBranchCommit c) {
     return BoolValBranch(v,c);
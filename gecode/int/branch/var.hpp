@@ -61,6 +61,14 @@ namespace Gecode {
   IntVarBranch::IntVarBranch(Select s0, IntCHB c, BranchTbl t)
     : VarBranch<IntVar>(c,t), s(s0) {}
 
+  forceinline
+  IntVarBranch::IntVarBranch(Select s0, int k, BranchTbl t)
+    : VarBranch<IntVar>(k,t), s(s0) {}
+
+  forceinline
+  IntVarBranch::IntVarBranch(Select s0, IntConflict c, BranchTbl t)
+    : VarBranch<IntVar>(c,t), s(s0) {}
+
   forceinline
   IntVarBranch::IntVarBranch(Select s0, IntBranchMerit mf, BranchTbl t)
     : VarBranch<IntVar>(mf,t), s(s0) {}
@@ -88,6 +96,10 @@ namespace Gecode {
       if (!_chb)
         _chb = IntCHB(home,x);
       break;
+    case SEL_CONFLICT:
+      if (!_cfl)
+        _cfl = IntConflict(home,x,conflicts());
+      break;
     default: ;
     }
   }
@@ -302,6 +314,21 @@ namespace Gecode {
     return IntVarBranch(IntVarBranch::SEL_REGRET_MAX_MAX,tbl);
   }
 
+  inline IntVarBranch
+  INT_VAR_LAST_CONFLICT(int k, BranchTbl tbl) {
+    return IntVarBranch(IntVarBranch::SEL_CONFLICT,k,tbl);
+  }
+
+  inline IntVarBranch
+  INT_VAR_LAST_CONFLICT(IntConflict c, BranchTbl tbl) {
+    return IntVarBranch(IntVarBranch::SEL_CONFLICT,c,tbl);
+  }
+
+  inline IntVarBranch
+  INT_VAR_CONFLICT_ORDER(BranchTbl tbl) {
+    return IntVarBranch(IntVarBranch::SEL_CONFLICT,0,tbl);
+  }
+
 
 
   forceinline
@@ -332,6 +359,14 @@ namespace Gecode {
   BoolVarBranch::BoolVarBranch(Select s0, BoolCHB c, BranchTbl t)
     : VarBranch<BoolVar>(c,t), s(s0) {}
 
+  forceinline
+  BoolVarBranch::BoolVarBranch(Select s0, int k, BranchTbl t)
+    : VarBranch<BoolVar>(k,t), s(s0) {}
+
+  forceinline
+  BoolVarBranch::BoolVarBranch(Select s0, BoolConflict c, BranchTbl t)
+    : VarBranch<BoolVar>(c,t), s(s0) {}
+
   forceinline
   BoolVarBranch::BoolVarBranch(Select s0, BoolBranchMerit mf, BranchTbl t)
     : VarBranch<BoolVar>(mf,t), s(s0) {}
@@ -356,6 +391,10 @@ namespace Gecode {
       if (!_chb)
         _chb = BoolCHB(home,x);
       break;
+    case SEL_CONFLICT:
+      if (!_cfl)
+        _cfl = BoolConflict(home,x,conflicts());
+      break;
     default: ;
     }
   }
@@ -450,6 +489,21 @@ namespace Gecode {
     return BoolVarBranch(BoolVarBranch::SEL_CHB_MAX,tbl);
   }
 
+  inline BoolVarBranch
+  BOOL_VAR_LAST_CONFLICT(int k, BranchTbl tbl) {
+    return BoolVarBranch(BoolVarBranch::SEL_CONFLICT,k,tbl);
+  }
+
+  inline BoolVarBranch
+  BOOL_VAR_LAST_CONFLICT(BoolConflict c, BranchTbl tbl) {
+    return BoolVarBranch(BoolVarBranch::SEL_CONFLICT,c,tbl);
+  }
+
+  inline BoolVarBranch
+  BOOL_VAR_CONFLICT_ORDER(BranchTbl tbl) {
+    return BoolVarBranch(BoolVarBranch::SEL_CONFLICT,0,tbl);
+  }
+
 }
 
 // STATISTICS: int-branch
@@ -102,6 +102,8 @@ namespace Gecode { namespace Int { namespace Branch {
         return new (home) ViewSelMinTbl<MeritRegretMax<IntView>>(home,ivb);
       case IntVarBranch::SEL_REGRET_MAX_MAX:
         return new (home) ViewSelMaxTbl<MeritRegretMax<IntView>>(home,ivb);
+      case IntVarBranch::SEL_CONFLICT:
+        return new (home) ViewSelMaxTbl<MeritConflict<IntView>>(home,ivb);
       default:
         throw UnknownBranching("Int::branch");
       }
@@ -112,17 +114,17 @@ namespace Gecode { namespace Int { namespace Branch {
       case IntVarBranch::SEL_MERIT_MAX:
         return new (home) ViewSelMax<MeritFunction<IntView>>(home,ivb);
       case IntVarBranch::SEL_MIN_MIN:
-        return new (home) ViewSelMin<MeritMin<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritMin<IntView>>(home,ivb);
       case IntVarBranch::SEL_MIN_MAX:
-        return new (home) ViewSelMax<MeritMin<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritMin<IntView>>(home,ivb);
       case IntVarBranch::SEL_MAX_MIN:
-        return new (home) ViewSelMin<MeritMax<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritMax<IntView>>(home,ivb);
       case IntVarBranch::SEL_MAX_MAX:
-        return new (home) ViewSelMax<MeritMax<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritMax<IntView>>(home,ivb);
       case IntVarBranch::SEL_SIZE_MIN:
-        return new (home) ViewSelMin<MeritSize<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritSize<IntView>>(home,ivb);
       case IntVarBranch::SEL_SIZE_MAX:
-        return new (home) ViewSelMax<MeritSize<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritSize<IntView>>(home,ivb);
       case IntVarBranch::SEL_DEGREE_MIN:
         return new (home) ViewSelMin<MeritDegree<IntView>>(home,ivb);
       case IntVarBranch::SEL_DEGREE_MAX:
@@ -156,13 +158,15 @@ namespace Gecode { namespace Int { namespace Branch {
       case IntVarBranch::SEL_CHB_SIZE_MAX:
         return new (home) ViewSelMax<MeritCHBSize<IntView>>(home,ivb);
       case IntVarBranch::SEL_REGRET_MIN_MIN:
-        return new (home) ViewSelMin<MeritRegretMin<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritRegretMin<IntView>>(home,ivb);
       case IntVarBranch::SEL_REGRET_MIN_MAX:
-        return new (home) ViewSelMax<MeritRegretMin<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritRegretMin<IntView>>(home,ivb);
       case IntVarBranch::SEL_REGRET_MAX_MIN:
-        return new (home) ViewSelMin<MeritRegretMax<IntView>>(home,ivb);
+        return new (home) ViewSelMinHeap<MeritRegretMax<IntView>>(home,ivb);
       case IntVarBranch::SEL_REGRET_MAX_MAX:
-        return new (home) ViewSelMax<MeritRegretMax<IntView>>(home,ivb);
+        return new (home) ViewSelMaxHeap<MeritRegretMax<IntView>>(home,ivb);
+      case IntVarBranch::SEL_CONFLICT:
+        return new (home) ViewSelMax<MeritConflict<IntView>>(home,ivb);
       default:
         throw UnknownBranching("Int::branch");
       }
@@ -202,6 +206,8 @@ namespace Gecode { namespace Int { namespace Branch {
         return new (home) ViewSelMinTbl<MeritCHB<BoolView>>(home,bvb);
       case BoolVarBranch::SEL_CHB_MAX:
         return new (home) ViewSelMaxTbl<MeritCHB<BoolView>>(home,bvb);
+      case BoolVarBranch::SEL_CONFLICT:
+        return new (home) ViewSelMaxTbl<MeritConflict<BoolView>>(home,bvb);
       default:
         throw UnknownBranching("Int::branch");
       }
@@ -227,6 +233,8 @@ namespace Gecode { namespace Int { namespace Branch {
         return new (home) ViewSelMin<MeritCHB<BoolView>>(home,bvb);
       case BoolVarBranch::SEL_CHB_MAX:
         return new (home) ViewSelMax<MeritCHB<BoolView>>(home,bvb);
+      case BoolVarBranch::SEL_CONFLICT:
+        return new (home) ViewSelMax<MeritConflict<BoolView>>(home,bvb);
       default:
         throw UnknownBranching("Int::branch");
       }
@@ -264,6 +264,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.expand(home,x);
+    vals.expand(home,x);
     ViewArray<IntView> xv(home,x);
     ViewSel<IntView>* vs[1] = {
       Branch::viewsel(home,vars)
@@ -313,6 +314,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.a.expand(home,x);
+    vals.expand(home,x);
     if ((vars.a.select() == IntVarBranch::SEL_NONE) ||
         (vars.a.select() == IntVarBranch::SEL_RND))
       vars.b = INT_VAR_NONE();
@@ -428,6 +430,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.expand(home,x);
+    vals.expand(home,x);
     ViewArray<BoolView> xv(home,x);
     ViewSel<BoolView>* vs[1] = {
       Branch::viewsel(home,vars)
@@ -474,6 +477,7 @@ namespace Gecode {
     using namespace Int;
     if (home.failed()) return;
     vars.a.expand(home,x);
+    vals.expand(home,x);
     if ((vars.a.select() == BoolVarBranch::SEL_NONE) ||
         (vars.a.select() == BoolVarBranch::SEL_RND))
       vars.b = BOOL_VAR_NONE();
@@ -543,6 +547,69 @@ namespace Gecode {
     }
   }
 
+  void
+  sbdd(Home home, const IntVarArgs& x,
+       IntVarBranch vars, IntValBranch vals,
+       const Symmetries& syms,
+       IntBranchFilter bf,
+       IntVarValPrint vvp) {
+    using namespace Int;
+    if (home.failed()) return;
+    vars.expand(home,x);
+    vals.expand(home,x);
+    switch (vals.select()) {
+    case IntValBranch::SEL_SPLIT_MIN:
+    case IntValBranch::SEL_SPLIT_MAX:
+    case IntValBranch::SEL_RANGE_MIN:
+    case IntValBranch::SEL_RANGE_MAX:
+    case IntValBranch::SEL_VALUES_MIN:
+    case IntValBranch::SEL_VALUES_MAX:
+      throw LDSBBadValueSelection("Int::LDSB::sbdd");
+      break;
+    case IntValBranch::SEL_VAL_COMMIT:
+      if (vals.commit())
+        throw LDSBBadValueSelection("Int::LDSB::sbdd");
+      // Without a commit function the left alternative is x=n
+    default:
+      {
+        ArgArray<VarImpBase*> xi(x.size());
+        for (int i=0; i<x.size(); i++)
+          xi[i] = x[i].varimp();
+        SBDDSymmetries s(syms,xi);
+        ViewArray<IntView> xv(home,x);
+        ViewSel<IntView>* vs[1] = {
+          Branch::viewsel(home,vars)
+        };
+        postsbddbrancher<IntView,PC_INT_VAL,1,int,2>
+          (home,xv,vs,Branch::valselcommit(home,vals),s,bf,vvp);
+      }
+    }
+  }
+
+  void
+  sbdd(Home home, const BoolVarArgs& x,
+       BoolVarBranch vars, BoolValBranch vals,
+       const Symmetries& syms,
+       BoolBranchFilter bf,
+       BoolVarValPrint vvp) {
+    using namespace Int;
+    if (home.failed()) return;
+    vars.expand(home,x);
+    vals.expand(home,x);
+    if ((vals.select() == BoolValBranch::SEL_VAL_COMMIT) && vals.commit())
+      throw LDSBBadValueSelection("Int::LDSB::sbdd");
+    ArgArray<VarImpBase*> xi(x.size());
+    for (int i=0; i<x.size(); i++)
+      xi[i] = x[i].varimp();
+    SBDDSymmetries s(syms,xi);
+    ViewArray<BoolView> xv(home,x);
+    ViewSel<BoolView>* vs[1] = {
+      Branch::viewsel(home,vars)
+    };
+    postsbddbrancher<BoolView,PC_BOOL_VAL,1,int,2>
+      (home,xv,vs,Branch::valselcommit(home,vals),s,bf,vvp);
+  }
+
 }
 
 
@@ -157,12 +157,76 @@ namespace Gecode { namespace Int { namespace LDSB {
     ValueSequenceSymmetryObject(IntArgs vs, int ss);
   };
 
+  /**
+   * \brief Sequences of a sequence symmetry compiled into flat arrays
+   *
+   * Stores the elements (variable indices or values) of all sequences
+   * in a single array together with a map from each element to its
+   * first position and, for each position, the next position holding
+   * the same element. The table never changes during search and hence
+   * is shared among all copies of a symmetry.
+   */
+  class GECODE_INT_EXPORT SequenceTable : public SharedHandle {
+  protected:
+    /// The actual table
+    class GECODE_VTABLE_EXPORT Table : public SharedHandle::Object {
+    public:
+      /// Number of elements
+      int n;
+      /// Size of each sequence
+      int seq_size;
+      /// Number of sequences
+      int n_seqs;
+      /// Elements of all sequences
+      int* elem;
+      /// Smallest element
+      int min;
+      /// Number of entries in \a first
+      int n_first;
+      /// First position of element \a e is \a first[e-min] (or -1)
+      int* first;
+      /// Next position with the same element as position \a p (or -1)
+      int* next;
+      /// Compile \a n elements \a e in sequences of size \a seq_size
+      Table(const int* e, int n, int seq_size);
+      /// Delete table
+      virtual ~Table(void);
+    };
+    /// Return table
+    const Table& table(void) const;
+  public:
+    /// Initialize empty table
+    SequenceTable(void);
+    /// Compile \a n elements \a e in sequences of size \a seq_size
+    SequenceTable(const int* e, int n, int seq_size);
+    /// Copy constructor
+    SequenceTable(const SequenceTable& t);
+    /// Assignment operator
+    SequenceTable& operator =(const SequenceTable& t);
+    /// Return size of each sequence
+    int seq_size(void) const;
+    /// Return number of sequences
+    int n_seqs(void) const;
+    /// Return elements of sequence \a s
+    const int* seq(int s) const;
+    /// Return element at position \a p in sequence \a s
+    int operator ()(int s, int p) const;
+    /// Return first position of element \a e (or -1)
+    int first(int e) const;
+    /// Return next position with the same element as position \a p (or -1)
+    int next(int p) const;
+  };
+
+  /// Stack of literals used while computing symmetric literals
+  typedef Support::DynamicStack<Literal,Region> LiteralStack;
+
   /// Implementation of a single symmetry.
   template<class View>
   class SymmetryImp {
   public:
-    /// Compute symmetric literals
-    virtual ArgArray<Literal> symmetric(Literal, const ViewArray<View>&) const = 0;
+    /// Push literals symmetric to \a l onto \a s
+    virtual void symmetric(Literal l, const ViewArray<View>& x,
+                           LiteralStack& s) const = 0;
     /// Left-branch update
     virtual void update(Literal) = 0;
     /// Copy function
@@ -193,8 +257,9 @@ namespace Gecode { namespace Int { namespace LDSB {
     virtual size_t dispose(Space& home);
     /// Left-branch update
     void update(Literal);
-    /// Compute symmetric literals
-    virtual ArgArray<Literal> symmetric(Literal, const ViewArray<View>&) const;
+    /// Push literals symmetric to \a l onto \a s
+    virtual void symmetric(Literal l, const ViewArray<View>& x,
+                           LiteralStack& s) const;
     /// Copy function
     SymmetryImp<View>* copy(Space& home) const;
   };
@@ -213,8 +278,9 @@ namespace Gecode { namespace Int { namespace LDSB {
     virtual size_t dispose(Space& home);
     /// Left-branch update
     void update(Literal);
-    /// Compute symmetric literals
-    virtual ArgArray<Literal> symmetric(Literal, const ViewArray<View>&) const;
+    /// Push literals symmetric to \a l onto \a s
+    virtual void symmetric(Literal l, const ViewArray<View>& x,
+                           LiteralStack& s) const;
     /// Copy function
     SymmetryImp<View>* copy(Space& home) const;
   };
@@ -223,29 +289,8 @@ namespace Gecode { namespace Int { namespace LDSB {
   class VariableSequenceSymmetryImp : public SymmetryImp<View>
   {
   protected:
-    /// Array of variable indices
-    unsigned int *indices;
-    /// Total number of indices (n_seqs * seq_size)
-    unsigned int n_indices;
-    /// Size of each sequence in symmetry
-    unsigned int seq_size;
-    /// Number of sequences in symmetry
-    unsigned int n_seqs;
-
-    /// Map from variable's index to its sequence and position.
-    // e.g. lookup[2] == 10 indicates that the variable with index 2
-    // occurs at position 10 in the "indices" array.
-    // If a variable occurs more than once, only the first occurrence
-    // is recorded.
-    // A value of -1 indicates that the variable does not occur in
-    // "indices".
-    int *lookup;
-    /// Size of lookup
-    unsigned int lookup_size;
-
-    /// Get the value in the specified sequence at the specified
-    /// position.  (Both are zero-based.)
-    int getVal(unsigned int sequence, unsigned int position) const;
+    /// Sequences of variable indices (shared among all copies)
+    SequenceTable indices;
   public:
     /// Constructor for creation
     VariableSequenceSymmetryImp<View>(Space& home, int *_indices, unsigned int n, unsigned int seqsize);
@@ -255,8 +300,9 @@ namespace Gecode { namespace Int { namespace LDSB {
     virtual size_t dispose(Space& home);
     /// Search left-branch update
     void update(Literal);
-    /// Compute symmetric literals
-    virtual ArgArray<Literal> symmetric(Literal, const ViewArray<View>&) const;
+    /// Push literals symmetric to \a l onto \a s
+    virtual void symmetric(Literal l, const ViewArray<View>& x,
+                           LiteralStack& s) const;
     /// Copy function
     SymmetryImp<View>* copy(Space& home) const;
   };
@@ -265,19 +311,10 @@ namespace Gecode { namespace Int { namespace LDSB {
   class ValueSequenceSymmetryImp : public SymmetryImp<View>
   {
   protected:
-    /// Set of sequences
-    int *values;
-    /// Total number of values (n_seqs * seq_size)
-    unsigned int n_values;
-    /// Size of each sequence in symmetry
-    unsigned int seq_size;
-    /// Number of sequences in symmetry
-    unsigned int n_seqs;
+    /// Sequences of values (shared among all copies)
+    SequenceTable values;
     /// Which sequences are dead
     Support::BitSet<Space> dead_sequences;
-    /// Get the value in the specified sequence at the specified
-    /// position.  (Both are zero-based.)
-    int getVal(unsigned int sequence, unsigned int position) const;
   private:
     ValueSequenceSymmetryImp<View>(const ValueSequenceSymmetryImp<View>&);
   public:
@@ -289,8 +326,9 @@ namespace Gecode { namespace Int { namespace LDSB {
     virtual size_t dispose(Space& home);
     /// Left-branch update
     void update(Literal);
-    /// Compute symmetric literals
-    virtual ArgArray<Literal> symmetric(Literal, const ViewArray<View>&) const;
+    /// Push literals symmetric to \a l onto \a s
+    virtual void symmetric(Literal l, const ViewArray<View>& x,
+                           LiteralStack& s) const;
     /// Copy function
     SymmetryImp<View>* copy(Space& home) const;
   };
@@ -385,10 +423,229 @@ namespace Gecode { namespace Int { namespace LDSB {
   template<class View>
   ModEvent prune(Space& home, View x, int v);
 
+  /// Test whether literal with value \a v for view \a x is entailed
+  template<class View>
+  bool entailed(View x, int v);
+
+  /**
+   * \brief Symmetries for symmetry breaking by dominance detection
+   *
+   * Each symmetry is represented by interchangeable sequences of
+   * either variables (by their position in the array branched on)
+   * or values, where variable and value symmetries have sequences
+   * of size one. The symmetries are shared among all spaces.
+   */
+  class GECODE_INT_EXPORT SBDDSymmetries : public SharedHandle {
+  protected:
+    /// A single symmetry
+    class Symmetry {
+    public:
+      /// Whether the sequences are sequences of variables or values
+      bool var;
+      /// Number of sequences
+      int n_seq;
+      /// Size of each sequence
+      int seq_size;
+      /// Elements (positions of variables or values) of all sequences
+      int* elem;
+      /// Smallest element
+      int min;
+      /// Number of entries in \a pos
+      int n_pos;
+      /// First position in \a elem of element \a e is \a pos[e-min] (or -1)
+      int* pos;
+      /// Return first position of element \a e in \a elem (or -1)
+      int position(int e) const;
+    };
+    /// Object for storing the symmetries
+    class GECODE_VTABLE_EXPORT SymObject : public SharedHandle::Object {
+    public:
+      /// Number of symmetries
+      int n;
+      /// The symmetries
+      Symmetry* s;
+      /// Allocate for \a n symmetries
+      SymObject(int n);
+      /// Delete object
+      virtual ~SymObject(void);
+    };
+    /// Test whether symmetry \a s maps literals in sequence \a j to sequence \a b
+    template<class View>
+    static bool maps(const Symmetry& s, const ViewArray<View>& x,
+                     const Literal* l, const int* g, const int* p, int n_l,
+                     int j, int b);
+    /// Find augmenting path for sequence \a j
+    template<class View>
+    static bool augment(const Symmetry& s, const ViewArray<View>& x,
+                        const Literal* l, const int* g, const int* p,
+                        int n_l, int j, signed char* ok, bool* visited,
+                        int* match);
+    /// Test whether symmetry \a s maps literals \a l to entailed literals
+    template<class View>
+    static bool dominated(const Symmetry& s, const ViewArray<View>& x,
+                          const Literal* l, int n_l);
+  public:
+    /// Initialize with no symmetries
+    SBDDSymmetries(void);
+    /// Initialize with symmetries \a syms for variables \a x
+    SBDDSymmetries(const Symmetries& syms, const ArgArray<VarImpBase*>& x);
+    /// Copy constructor
+    SBDDSymmetries(const SBDDSymmetries& s);
+    /// Assignment operator
+    SBDDSymmetries& operator =(const SBDDSymmetries& s);
+    /// Return number of symmetries
+    int size(void) const;
+    /// Test whether a symmetry maps the literals \a l to entailed literals
+    template<class View>
+    bool dominated(const ViewArray<View>& x, const Literal* l, int n_l) const;
+  };
+
+  /**
+   * \brief Space-local store of decisions and nogoods
+   *
+   * Stores the literals of the left alternatives (decisions) on the
+   * path to the current node. A nogood is recorded for each right
+   * alternative on the path: it consists of the decisions before it
+   * and the literal of the left alternative, whose subtree has been
+   * explored.
+   */
+  class GECODE_INT_EXPORT SBDDStore : public LocalObject {
+  protected:
+    /// Number of decisions
+    int n_d;
+    /// Capacity for decisions
+    int c_d;
+    /// The decisions
+    Literal* d;
+    /// Number of nogoods
+    int n_ng;
+    /// Capacity for nogoods
+    int c_ng;
+    /// Number of decisions in each nogood
+    int* ng;
+    /// Last literal of each nogood
+    Literal* ngl;
+  public:
+    /// Initialize empty store
+    SBDDStore(Space& home);
+    /// Constructor for cloning \a s
+    SBDDStore(Space& home, SBDDStore& s);
+    /// Copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Record decision \a l
+    void decide(Space& home, const Literal& l);
+    /// Record nogood with decisions so far and \a l
+    void nogood(Space& home, const Literal& l);
+    /// Return number of nogoods
+    int nogoods(void) const;
+    /// Test whether nogood \a k is mapped by \a s to entailed literals
+    template<class View>
+    bool dominated(const SBDDSymmetries& s, const ViewArray<View>& x,
+                   int k) const;
+  };
+
+  /// Handle to store of decisions and nogoods
+  class SBDDHandle : public LocalHandle {
+  public:
+    /// Create handle to no store
+    SBDDHandle(void);
+    /// Create handle to store \a s
+    SBDDHandle(SBDDStore* s);
+    /// Copy constructor
+    SBDDHandle(const SBDDHandle& h);
+    /// Return store
+    SBDDStore& operator *(void) const;
+  };
+
+  /**
+   * \brief Propagator for dominance detection
+   *
+   * Fails if a symmetry maps a nogood to literals that are all
+   * entailed. The propagator is run whenever a literal might have
+   * become entailed (propagation condition \a pc).
+   */
+  template<class View, PropCond pc>
+  class SBDDChecker : public NaryPropagator<View,pc> {
+  protected:
+    using NaryPropagator<View,pc>::x;
+    /// The symmetries
+    SBDDSymmetries s;
+    /// The decisions and nogoods
+    SBDDHandle h;
+    /// Constructor for cloning \a p
+    SBDDChecker(Space& home, SBDDChecker& p);
+  public:
+    /// Constructor for creation
+    SBDDChecker(Home home, ViewArray<View>& x, const SBDDSymmetries& s,
+                SBDDHandle& h);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home);
+    /// Cost function (quadratic in the number of nogoods)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief Brancher for symmetry breaking by dominance detection
+   *
+   * Records decisions and nogoods when committing and fails for a
+   * right alternative that is dominated by its own nogood.
+   */
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  class SBDDBrancher : public ViewValBrancher<View,n,Val,a,Filter,Print> {
+  public:
+    using typename ViewValBrancher<View,n,Val,a,Filter,Print>::Var;
+  protected:
+    /// The symmetries
+    SBDDSymmetries s;
+    /// The decisions and nogoods
+    SBDDHandle h;
+    /// Constructor for cloning \a b
+    SBDDBrancher(Space& home, SBDDBrancher& b);
+    /// Constructor for creation
+    SBDDBrancher(Home home,
+                 ViewArray<View>& x,
+                 ViewSel<View>* vs[n],
+                 ValSelCommitBase<View,Val>* vsc,
+                 const SBDDSymmetries& s, SBDDHandle& h,
+                 BranchFilter<Var> bf,
+                 VarValPrint<Var,Val> vvp);
+  public:
+    /// Perform commit for choice \a c and alternative \a b
+    virtual ExecStatus commit(Space& home, const Choice& c, unsigned int b);
+    /// Perform cloning
+    virtual Actor* copy(Space& home);
+    /// Delete brancher and return its size
+    virtual size_t dispose(Space& home);
+    /// Brancher post function
+    static void post(Home home,
+                     ViewArray<View>& x,
+                     ViewSel<View>* vs[n],
+                     ValSelCommitBase<View,Val>* vsc,
+                     const SBDDSymmetries& s, SBDDHandle& h,
+                     BranchFilter<Var> bf,
+                     VarValPrint<Var,Val> vvp);
+  };
+
+  /// Post brancher and propagator for dominance detection
+  template<class View, PropCond pc, int n, class Val, unsigned int a>
+  void postsbddbrancher(Home home,
+                        ViewArray<View>& x,
+                        ViewSel<View>* vs[n],
+                        ValSelCommitBase<View,Val>* vsc,
+                        const SBDDSymmetries& s,
+                        BranchFilter<typename View::VarType> bf,
+                        VarValPrint<typename View::VarType,Val> vvp);
+
 }}}
 
 #include <gecode/int/ldsb/brancher.hpp>
 #include <gecode/int/ldsb/sym-imp.hpp>
+#include <gecode/int/ldsb/sbdd.hpp>
 
 #endif
 
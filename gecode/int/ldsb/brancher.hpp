@@ -31,7 +31,6 @@
  *
  */
 
-#include <deque>
 #include <set>
 
 namespace Gecode { namespace Int { namespace LDSB {
@@ -158,27 +157,26 @@ namespace Gecode { namespace Int { namespace LDSB {
 
     _prevPos = choicePos;
 
-    // TODO: It should be possible to use simpler containers than the
-    // STL ones here.
-    std::deque<Literal> queue;
+    // The literals found so far, where the literals starting at
+    // position next have not yet been processed. Symmetric literals
+    // are pushed onto sym by all symmetries before being added.
+    Region r;
+    LiteralStack queue(r), sym(r);
     std::set<Literal> seen;
 
     seen.insert(Literal(choicePos, choiceVal));
-    queue.push_back(Literal(choicePos, choiceVal));
-
-    do {
-      Literal l = queue[0];
-      queue.pop_front();
-
-      for (int i = 0 ; i < _nsyms ; i++) {
-        ArgArray<Literal> toExclude = _syms[i]->symmetric(l, this->x);
-        for (int j = 0 ; j < toExclude.size() ; ++j) {
-          if (seen.find(toExclude[j]) == seen.end())
-            queue.push_back(toExclude[j]);
-          seen.insert(toExclude[j]);
-        }
+    queue.push(Literal(choicePos, choiceVal));
+
+    for (int next = 0 ; next < queue.entries() ; next++) {
+      Literal l = queue[next];
+      for (int i = 0 ; i < _nsyms ; i++)
+        _syms[i]->symmetric(l, this->x, sym);
+      while (!sym.empty()) {
+        Literal s = sym.pop();
+        if (seen.insert(s).second)
+          queue.push(s);
       }
-    } while (queue.size() > 0);
+    }
 
     // Convert "seen" vector into array.
     int nliterals = static_cast<int>(seen.size());
@@ -266,6 +264,8 @@ namespace Gecode { namespace Int { namespace LDSB {
   size_t
   LDSBBrancher<View,n,Val,a,Filter,Print>::dispose(Space& home) {
     home.ignore(*this,AP_DISPOSE,true);
+    for (int i = 0 ; i < _nsyms ; i++)
+      _syms[i]->dispose(home);
     (void) ViewValBrancher<View,n,Val,a,Filter,Print>::dispose(home);
     return sizeof(LDSBBrancher<View,n,Val,a,Filter,Print>);
   }
@@ -0,0 +1,138 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/ldsb.hh>
+
+#include <map>
+
+namespace Gecode { namespace Int { namespace LDSB {
+
+  SBDDSymmetries::SymObject::SymObject(int n0)
+    : n(n0), s(heap.alloc<Symmetry>(n0)) {}
+
+  SBDDSymmetries::SymObject::~SymObject(void) {
+    for (int i=0; i<n; i++) {
+      heap.free<int>(s[i].elem,s[i].n_seq*s[i].seq_size);
+      heap.free<int>(s[i].pos,s[i].n_pos);
+    }
+    heap.free<Symmetry>(s,n);
+  }
+
+  SBDDSymmetries::SBDDSymmetries(void)
+    : SharedHandle(new SymObject(0)) {}
+
+  SBDDSymmetries::SBDDSymmetries(const Symmetries& syms,
+                                 const ArgArray<VarImpBase*>& x)
+    : SharedHandle(new SymObject(syms.size())) {
+    // Map from variable implementation to position in x
+    std::map<VarImpBase*,int> vm;
+    for (int i=0; i<x.size(); i++)
+      vm[x[i]] = i;
+    SymObject* so = static_cast<SymObject*>(object());
+    for (int i=0; i<so->n; i++) {
+      Symmetry& s = so->s[i];
+      const SymmetryObject* o = syms[i].ref;
+      if (const VariableSymmetryObject* vo =
+          dynamic_cast<const VariableSymmetryObject*>(o)) {
+        s.var = true; s.n_seq = vo->nxs; s.seq_size = 1;
+        s.elem = heap.alloc<int>(vo->nxs);
+        for (int j=0; j<vo->nxs; j++) {
+          std::map<VarImpBase*,int>::const_iterator e = vm.find(vo->xs[j]);
+          if (e == vm.end())
+            throw LDSBUnbranchedVariable("Int::LDSB::SBDDSymmetries");
+          s.elem[j] = e->second;
+        }
+      } else if (const ValueSymmetryObject* vo =
+                 dynamic_cast<const ValueSymmetryObject*>(o)) {
+        s.var = false; s.n_seq = static_cast<int>(vo->values.size());
+        s.seq_size = 1;
+        s.elem = heap.alloc<int>(s.n_seq);
+        int j = 0;
+        for (IntSetValues v(vo->values); v(); ++v)
+          s.elem[j++] = v.val();
+      } else if (const VariableSequenceSymmetryObject* vo =
+                 dynamic_cast<const VariableSequenceSymmetryObject*>(o)) {
+        s.var = true; s.n_seq = vo->nxs / vo->seq_size;
+        s.seq_size = vo->seq_size;
+        s.elem = heap.alloc<int>(vo->nxs);
+        for (int j=0; j<vo->nxs; j++) {
+          std::map<VarImpBase*,int>::const_iterator e = vm.find(vo->xs[j]);
+          if (e == vm.end())
+            throw LDSBUnbranchedVariable("Int::LDSB::SBDDSymmetries");
+          s.elem[j] = e->second;
+        }
+      } else if (const ValueSequenceSymmetryObject* vo =
+                 dynamic_cast<const ValueSequenceSymmetryObject*>(o)) {
+        s.var = false; s.n_seq = vo->values.size() / vo->seq_size;
+        s.seq_size = vo->seq_size;
+        s.elem = heap.alloc<int>(vo->values.size());
+        for (int j=0; j<vo->values.size(); j++)
+          s.elem[j] = vo->values[j];
+      } else {
+        GECODE_NEVER;
+      }
+      // Map elements to their first position
+      int n_e = s.n_seq * s.seq_size;
+      int min = 0, max = -1;
+      if (n_e > 0) {
+        min = max = s.elem[0];
+        for (int j=1; j<n_e; j++) {
+          min = std::min(min,s.elem[j]); max = std::max(max,s.elem[j]);
+        }
+      }
+      s.min = min; s.n_pos = max - min + 1;
+      s.pos = heap.alloc<int>(s.n_pos);
+      for (int j=0; j<s.n_pos; j++)
+        s.pos[j] = -1;
+      for (int j=n_e; j--; )
+        s.pos[s.elem[j] - min] = j;
+    }
+  }
+
+  SBDDSymmetries::SBDDSymmetries(const SBDDSymmetries& s)
+    : SharedHandle(s) {}
+
+  SBDDSymmetries&
+  SBDDSymmetries::operator =(const SBDDSymmetries& s) {
+    (void) SharedHandle::operator =(s);
+    return *this;
+  }
+
+  Actor*
+  SBDDStore::copy(Space& home) {
+    return new (home) SBDDStore(home,*this);
+  }
+
+}}}
+
+// STATISTICS: int-branch
@@ -0,0 +1,415 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace LDSB {
+
+  template <>
+  forceinline bool
+  entailed<Int::IntView>(Int::IntView x, int v) {
+    return x.assigned() && (x.val() == v);
+  }
+
+  template <>
+  forceinline bool
+  entailed<Int::BoolView>(Int::BoolView x, int v) {
+    return x.assigned() && (x.val() == v);
+  }
+
+
+  /*
+   * Symmetries for dominance detection
+   *
+   */
+  forceinline int
+  SBDDSymmetries::Symmetry::position(int e) const {
+    if ((e < min) || (e - min >= n_pos))
+      return -1;
+    return pos[e - min];
+  }
+
+  forceinline int
+  SBDDSymmetries::size(void) const {
+    return static_cast<SymObject*>(object())->n;
+  }
+
+  template<class View>
+  bool
+  SBDDSymmetries::maps(const Symmetry& s, const ViewArray<View>& x,
+                       const Literal* l, const int* g, const int* p, int n_l,
+                       int j, int b) {
+    for (int i=0; i<n_l; i++)
+      if (g[i] == j) {
+        int e = s.elem[b*s.seq_size + p[i]];
+        if (s.var ? !entailed(x[e],l[i]._value)
+                  : !entailed(x[l[i]._variable],e))
+          return false;
+      }
+    return true;
+  }
+
+  template<class View>
+  bool
+  SBDDSymmetries::augment(const Symmetry& s, const ViewArray<View>& x,
+                          const Literal* l, const int* g, const int* p,
+                          int n_l, int j, signed char* ok, bool* visited,
+                          int* match) {
+    for (int b=0; b<s.n_seq; b++) {
+      if (visited[b])
+        continue;
+      signed char& o = ok[j*s.n_seq + b];
+      if (o < 0)
+        o = maps(s,x,l,g,p,n_l,j,b) ? 1 : 0;
+      if (o == 0)
+        continue;
+      visited[b] = true;
+      if ((match[b] < 0) ||
+          augment(s,x,l,g,p,n_l,match[b],ok,visited,match)) {
+        match[b] = j;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template<class View>
+  bool
+  SBDDSymmetries::dominated(const Symmetry& s, const ViewArray<View>& x,
+                            const Literal* l, int n_l) {
+    Region r;
+    // Index of affected sequence and position for each literal
+    int* g = r.alloc<int>(n_l);
+    int* p = r.alloc<int>(n_l);
+    // Affected sequences
+    int* a = r.alloc<int>(n_l);
+    int n_a = 0;
+    for (int i=0; i<n_l; i++) {
+      int k = s.position(s.var ? l[i]._variable : l[i]._value);
+      if (k < 0) {
+        // The literal is not affected by the symmetry
+        if (!entailed(x[l[i]._variable],l[i]._value))
+          return false;
+        g[i] = -1;
+      } else {
+        p[i] = k % s.seq_size;
+        int q = k / s.seq_size;
+        int j = 0;
+        while ((j < n_a) && (a[j] != q))
+          j++;
+        if (j == n_a)
+          a[n_a++] = q;
+        g[i] = j;
+      }
+    }
+    /*
+     * Find a permutation of the sequences that maps all literals to
+     * entailed literals. This is a matching from the affected
+     * sequences to all sequences.
+     */
+    signed char* ok = r.alloc<signed char>(n_a*s.n_seq);
+    for (int i=0; i<n_a*s.n_seq; i++)
+      ok[i] = -1;
+    bool* visited = r.alloc<bool>(s.n_seq);
+    int* match = r.alloc<int>(s.n_seq);
+    for (int b=0; b<s.n_seq; b++)
+      match[b] = -1;
+    for (int j=0; j<n_a; j++) {
+      for (int b=0; b<s.n_seq; b++)
+        visited[b] = false;
+      if (!augment(s,x,l,g,p,n_l,j,ok,visited,match))
+        return false;
+    }
+    return true;
+  }
+
+  template<class View>
+  forceinline bool
+  SBDDSymmetries::dominated(const ViewArray<View>& x,
+                            const Literal* l, int n_l) const {
+    const SymObject* so = static_cast<SymObject*>(object());
+    for (int i=0; i<so->n; i++)
+      if (dominated(so->s[i],x,l,n_l))
+        return true;
+    return false;
+  }
+
+
+  /*
+   * Store for decisions and nogoods
+   *
+   */
+  forceinline
+  SBDDStore::SBDDStore(Space& home)
+    : LocalObject(home), n_d(0), c_d(4), d(home.alloc<Literal>(c_d)),
+      n_ng(0), c_ng(4), ng(home.alloc<int>(c_ng)),
+      ngl(home.alloc<Literal>(c_ng)) {}
+
+  forceinline
+  SBDDStore::SBDDStore(Space& home, SBDDStore& s)
+    : LocalObject(home,s), n_d(s.n_d), c_d(std::max(s.n_d,1)),
+      d(home.alloc<Literal>(c_d)),
+      n_ng(s.n_ng), c_ng(std::max(s.n_ng,1)), ng(home.alloc<int>(c_ng)),
+      ngl(home.alloc<Literal>(c_ng)) {
+    for (int i=0; i<n_d; i++)
+      d[i] = s.d[i];
+    for (int i=0; i<n_ng; i++) {
+      ng[i] = s.ng[i]; ngl[i] = s.ngl[i];
+    }
+  }
+
+  forceinline void
+  SBDDStore::decide(Space& home, const Literal& l) {
+    if (n_d == c_d) {
+      d = home.realloc<Literal>(d,c_d,2*c_d);
+      c_d *= 2;
+    }
+    d[n_d++] = l;
+  }
+
+  forceinline void
+  SBDDStore::nogood(Space& home, const Literal& l) {
+    if (n_ng == c_ng) {
+      ng = home.realloc<int>(ng,c_ng,2*c_ng);
+      ngl = home.realloc<Literal>(ngl,c_ng,2*c_ng);
+      c_ng *= 2;
+    }
+    ng[n_ng] = n_d; ngl[n_ng] = l; n_ng++;
+  }
+
+  forceinline int
+  SBDDStore::nogoods(void) const {
+    return n_ng;
+  }
+
+  template<class View>
+  bool
+  SBDDStore::dominated(const SBDDSymmetries& s, const ViewArray<View>& x,
+                       int k) const {
+    // The nogood consists of the first ng[k] decisions and ngl[k]
+    Region r;
+    int n_l = ng[k] + 1;
+    Literal* l = r.alloc<Literal>(n_l);
+    for (int i=0; i<ng[k]; i++)
+      l[i] = d[i];
+    l[ng[k]] = ngl[k];
+    return s.dominated(x,l,n_l);
+  }
+
+
+  /*
+   * Store handle
+   *
+   */
+  forceinline
+  SBDDHandle::SBDDHandle(void) {}
+
+  forceinline
+  SBDDHandle::SBDDHandle(SBDDStore* s)
+    : LocalHandle(s) {}
+
+  forceinline
+  SBDDHandle::SBDDHandle(const SBDDHandle& h)
+    : LocalHandle(h) {}
+
+  forceinline SBDDStore&
+  SBDDHandle::operator *(void) const {
+    return *static_cast<SBDDStore*>(object());
+  }
+
+
+  /*
+   * Dominance checking propagator
+   *
+   */
+  template<class View, PropCond pc>
+  forceinline
+  SBDDChecker<View,pc>::SBDDChecker(Home home, ViewArray<View>& x,
+                                    const SBDDSymmetries& s0,
+                                    SBDDHandle& h0)
+    : NaryPropagator<View,pc>(home,x), s(s0), h(h0) {
+    home.notice(*this,AP_DISPOSE);
+  }
+
+  template<class View, PropCond pc>
+  forceinline
+  SBDDChecker<View,pc>::SBDDChecker(Space& home, SBDDChecker<View,pc>& p)
+    : NaryPropagator<View,pc>(home,p), s(p.s) {
+    h.update(home,p.h);
+  }
+
+  template<class View, PropCond pc>
+  Propagator*
+  SBDDChecker<View,pc>::copy(Space& home) {
+    return new (home) SBDDChecker<View,pc>(home,*this);
+  }
+
+  template<class View, PropCond pc>
+  PropCost
+  SBDDChecker<View,pc>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::quadratic(PropCost::HI,(*h).nogoods());
+  }
+
+  template<class View, PropCond pc>
+  ExecStatus
+  SBDDChecker<View,pc>::propagate(Space&, const ModEventDelta&) {
+    for (int k=0; k<(*h).nogoods(); k++)
+      if ((*h).dominated(s,x,k))
+        return ES_FAILED;
+    return ES_FIX;
+  }
+
+  template<class View, PropCond pc>
+  size_t
+  SBDDChecker<View,pc>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    s.~SBDDSymmetries();
+    (void) NaryPropagator<View,pc>::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * Brancher
+   *
+   */
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  forceinline
+  SBDDBrancher<View,n,Val,a,Filter,Print>
+  ::SBDDBrancher(Home home, ViewArray<View>& x,
+                 ViewSel<View>* vs[n],
+                 ValSelCommitBase<View,Val>* vsc,
+                 const SBDDSymmetries& s0, SBDDHandle& h0,
+                 BranchFilter<Var> bf,
+                 VarValPrint<Var,Val> vvp)
+    : ViewValBrancher<View,n,Val,a,Filter,Print>(home,x,vs,vsc,bf,vvp),
+      s(s0), h(h0) {
+    home.notice(*this,AP_DISPOSE,true);
+  }
+
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  forceinline
+  SBDDBrancher<View,n,Val,a,Filter,Print>
+  ::SBDDBrancher(Space& home, SBDDBrancher<View,n,Val,a,Filter,Print>& b)
+    : ViewValBrancher<View,n,Val,a,Filter,Print>(home,b), s(b.s) {
+    h.update(home,b.h);
+  }
+
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  Actor*
+  SBDDBrancher<View,n,Val,a,Filter,Print>::copy(Space& home) {
+    return new (home) SBDDBrancher<View,n,Val,a,Filter,Print>(home,*this);
+  }
+
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  ExecStatus
+  SBDDBrancher<View,n,Val,a,Filter,Print>
+  ::commit(Space& home, const Choice& c, unsigned int b) {
+    GECODE_ES_CHECK((ViewValBrancher<View,n,Val,a,Filter,Print>
+                     ::commit(home,c,b)));
+    const PosValChoice<Val>& pvc
+      = static_cast<const PosValChoice<Val>&>(c);
+    Literal l(pvc.pos().pos,pvc.val());
+    if (b == 0) {
+      (*h).decide(home,l);
+    } else {
+      // The subtree for the first alternative has been explored
+      (*h).nogood(home,l);
+      if ((*h).dominated(s,this->x,(*h).nogoods()-1))
+        return ES_FAILED;
+    }
+    return ES_OK;
+  }
+
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  size_t
+  SBDDBrancher<View,n,Val,a,Filter,Print>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE,true);
+    s.~SBDDSymmetries();
+    (void) ViewValBrancher<View,n,Val,a,Filter,Print>::dispose(home);
+    return sizeof(SBDDBrancher<View,n,Val,a,Filter,Print>);
+  }
+
+  template<class View, int n, class Val, unsigned int a,
+           class Filter, class Print>
+  forceinline void
+  SBDDBrancher<View,n,Val,a,Filter,Print>
+  ::post(Home home, ViewArray<View>& x,
+         ViewSel<View>* vs[n], ValSelCommitBase<View,Val>* vsc,
+         const SBDDSymmetries& s, SBDDHandle& h,
+         BranchFilter<Var> bf, VarValPrint<Var,Val> vvp) {
+    (void) new (home) SBDDBrancher<View,n,Val,a,Filter,Print>
+      (home,x,vs,vsc,s,h,bf,vvp);
+  }
+
+  template<class View, PropCond pc, int n, class Val, unsigned int a>
+  void
+  postsbddbrancher(Home home,
+                   ViewArray<View>& x,
+                   ViewSel<View>* vs[n],
+                   ValSelCommitBase<View,Val>* vsc,
+                   const SBDDSymmetries& s,
+                   BranchFilter<typename View::VarType> bf,
+                   VarValPrint<typename View::VarType,Val> vvp) {
+    SBDDHandle h(new (home) SBDDStore(home));
+    if (s.size() > 0)
+      (void) new (home) SBDDChecker<View,pc>(home,x,s,h);
+    if (bf) {
+      if (vvp) {
+        SBDDBrancher<View,n,Val,a,BrancherFilter<View>,
+                     BrancherPrint<View,Val> >
+          ::post(home,x,vs,vsc,s,h,bf,vvp);
+      } else {
+        SBDDBrancher<View,n,Val,a,BrancherFilter<View>,
+                     BrancherNoPrint<View,Val> >
+          ::post(home,x,vs,vsc,s,h,bf,vvp);
+      }
+    } else {
+      if (vvp) {
+        SBDDBrancher<View,n,Val,a,BrancherNoFilter<View>,
+                     BrancherPrint<View,Val> >
+          ::post(home,x,vs,vsc,s,h,bf,vvp);
+      } else {
+        SBDDBrancher<View,n,Val,a,BrancherNoFilter<View>,
+                     BrancherNoPrint<View,Val> >
+          ::post(home,x,vs,vsc,s,h,bf,vvp);
+      }
+    }
+  }
+
+}}}
+
+// STATISTICS: int-branch
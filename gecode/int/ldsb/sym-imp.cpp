@@ -35,127 +35,38 @@
 #include <gecode/int/branch.hh>
 
 namespace Gecode { namespace Int { namespace LDSB {
-  /// Compute symmetric literals
-  template <>
-  ArgArray<Literal>
-  VariableSymmetryImp<IntView>
-  ::symmetric(Literal l, const ViewArray<IntView>& x) const {
-    (void) x;
-    if (indices.valid(l._variable) && indices.get(l._variable)) {
-      int n = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(indices) ; i() ; ++i)
-        n++;
-      ArgArray<Literal> lits(n);
-      int j = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(indices) ; i() ; ++i)
-        lits[j++] = Literal(i.val(), l._value);
-      return lits;
-    } else {
-      return ArgArray<Literal>(0);
-    }
-  }
-  /// Compute symmetric literals
-  template <>
-  ArgArray<Literal>
-  VariableSymmetryImp<BoolView>
-  ::symmetric(Literal l, const ViewArray<BoolView>& x) const {
-    (void) x;
-    if (indices.valid(l._variable) && indices.get(l._variable)) {
-      int n = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(indices) ; i() ; ++i)
-        n++;
-      ArgArray<Literal> lits(n);
-      int j = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(indices) ; i() ; ++i)
-        lits[j++] = Literal(i.val(), l._value);
-      return lits;
-    } else {
-      return ArgArray<Literal>(0);
-    }
-  }
 
-  /// Compute symmetric literals
-  template <>
-  ArgArray<Literal>
-  ValueSymmetryImp<IntView>
-  ::symmetric(Literal l, const ViewArray<IntView>& x) const {
-    (void) x;
-    if (values.valid(l._value) && values.get(l._value)) {
-      int n = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(values) ; i() ; ++i)
-        n++;
-      ArgArray<Literal> lits(n);
-      int j = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(values) ; i() ; ++i)
-        lits[j++] = Literal(l._variable, i.val());
-      return lits;
-    } else {
-      return ArgArray<Literal>(0);
+  SequenceTable::Table::Table(const int* e, int n0, int ss)
+    : n(n0), seq_size(ss), n_seqs(n0 / ss), elem(heap.alloc<int>(n0)),
+      min(0), n_first(0), first(NULL), next(heap.alloc<int>(n)) {
+    int max = -1;
+    if (n > 0) {
+      min = max = e[0];
+      for (int i=1; i<n; i++) {
+        min = std::min(min,e[i]); max = std::max(max,e[i]);
+      }
     }
-  }
-  /// Compute symmetric literals
-  template <>
-  ArgArray<Literal>
-  ValueSymmetryImp<BoolView>
-  ::symmetric(Literal l, const ViewArray<BoolView>& x) const {
-    (void) x;
-    if (values.valid(l._value) && values.get(l._value)) {
-      int n = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(values) ; i() ; ++i)
-        n++;
-      ArgArray<Literal> lits(n);
-      int j = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(values) ; i() ; ++i)
-        lits[j++] = Literal(l._variable, i.val());
-      return lits;
-    } else {
-      return ArgArray<Literal>(0);
+    n_first = max - min + 1;
+    first = heap.alloc<int>(n_first);
+    for (int i=0; i<n_first; i++)
+      first[i] = -1;
+    // Chain positions with the same element in increasing order
+    for (int i=n; i--; ) {
+      elem[i] = e[i];
+      next[i] = first[e[i] - min];
+      first[e[i] - min] = i;
     }
   }
 
-  /// Compute symmetric literals
-  template <>
-  ArgArray<Literal>
-  ValueSequenceSymmetryImp<Int::IntView>
-  ::symmetric(Literal l, const ViewArray<IntView>& x) const {
-    (void) x;
-    Region region;
-    Support::DynamicStack<Literal,Region> s(region);
-    std::pair<int,int> location = findVar(values, n_values, seq_size, l._value);
-    if (location.first == -1) return dynamicStackToArgArray(s);
-    unsigned int seqNum = location.first;
-    unsigned int seqPos = location.second;
-    if (! dead_sequences.get(seqNum)) {
-      for (unsigned int seq = 0 ; seq < n_seqs ; seq++) {
-        if (seq == seqNum) continue;
-        if (dead_sequences.get(seq)) continue;
-        s.push(Literal(l._variable, getVal(seq,seqPos)));
-      }
-    }
-    return dynamicStackToArgArray(s);
-  }
-  /// Compute symmetric literals
-  template <>
-  ArgArray<Literal>
-  ValueSequenceSymmetryImp<BoolView>
-  ::symmetric(Literal l, const ViewArray<BoolView>& x) const {
-    (void) x;
-    Region region;
-    Support::DynamicStack<Literal,Region> s(region);
-    std::pair<int,int> location = findVar(values, n_values, seq_size, l._value);
-    if (location.first == -1) return dynamicStackToArgArray(s);
-    unsigned int seqNum = location.first;
-    unsigned int seqPos = location.second;
-    if (! dead_sequences.get(seqNum)) {
-      for (unsigned int seq = 0 ; seq < n_seqs ; seq++) {
-        if (seq == seqNum) continue;
-        if (dead_sequences.get(seq)) continue;
-        s.push(Literal(l._variable, getVal(seq,seqPos)));
-      }
-    }
-    return dynamicStackToArgArray(s);
+  SequenceTable::Table::~Table(void) {
+    heap.free<int>(elem,n);
+    heap.free<int>(first,n_first);
+    heap.free<int>(next,n);
   }
 
+  SequenceTable::SequenceTable(const int* e, int n, int seq_size)
+    : SharedHandle(new Table(e,n,seq_size)) {}
+
 }}}
 
 // STATISTICS: int-branch
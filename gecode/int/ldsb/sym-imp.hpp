@@ -33,15 +33,59 @@
 
 namespace Gecode { namespace Int { namespace LDSB {
 
-  /// Convert a \a DynamicStack<T,A> into an \a ArgArray<T>
-  template <class T, class A>
-  ArgArray<T>
-  dynamicStackToArgArray(const Support::DynamicStack<T,A>& s) {
-    ArgArray<T> a(s.entries());
-    for (int i = 0 ; i < s.entries() ; ++i) {
-      a[i] = s[i];
-    }
-    return a;
+  /*
+   * Compiled sequences
+   *
+   */
+  forceinline
+  SequenceTable::SequenceTable(void) {}
+
+  forceinline
+  SequenceTable::SequenceTable(const SequenceTable& t)
+    : SharedHandle(t) {}
+
+  forceinline SequenceTable&
+  SequenceTable::operator =(const SequenceTable& t) {
+    (void) SharedHandle::operator =(t);
+    return *this;
+  }
+
+  forceinline const SequenceTable::Table&
+  SequenceTable::table(void) const {
+    return *static_cast<const Table*>(object());
+  }
+
+  forceinline int
+  SequenceTable::seq_size(void) const {
+    return table().seq_size;
+  }
+
+  forceinline int
+  SequenceTable::n_seqs(void) const {
+    return table().n_seqs;
+  }
+
+  forceinline const int*
+  SequenceTable::seq(int s) const {
+    return &table().elem[s*table().seq_size];
+  }
+
+  forceinline int
+  SequenceTable::operator ()(int s, int p) const {
+    return table().elem[s*table().seq_size + p];
+  }
+
+  forceinline int
+  SequenceTable::first(int e) const {
+    const Table& t = table();
+    if ((e < t.min) || (e - t.min >= t.n_first))
+      return -1;
+    return t.first[e - t.min];
+  }
+
+  forceinline int
+  SequenceTable::next(int p) const {
+    return table().next[p];
   }
 
   template<class View>
@@ -113,6 +157,16 @@ namespace Gecode { namespace Int { namespace LDSB {
     return new (home) VariableSymmetryImp<View>(home, *this);
   }
 
+  template <class View>
+  void
+  VariableSymmetryImp<View>
+  ::symmetric(Literal l, const ViewArray<View>&, LiteralStack& s) const {
+    if (indices.valid(l._variable) && indices.get(l._variable))
+      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> >
+             i(indices) ; i() ; ++i)
+        s.push(Literal(i.val(), l._value));
+  }
+
 
 
   // The minimum value in vs is the bitset's offset, and the maximum
@@ -166,101 +220,69 @@ namespace Gecode { namespace Int { namespace LDSB {
     return new (home) ValueSymmetryImp(home, *this);
   }
 
-
-
   template <class View>
-  int
-  VariableSequenceSymmetryImp<View>
-  ::getVal(unsigned int sequence, unsigned int position) const {
-    return indices[sequence*seq_size + position];
+  void
+  ValueSymmetryImp<View>
+  ::symmetric(Literal l, const ViewArray<View>&, LiteralStack& s) const {
+    if (values.valid(l._value) && values.get(l._value))
+      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> >
+             i(values) ; i() ; ++i)
+        s.push(Literal(l._variable, i.val()));
   }
 
+
+
   template <class View>
   VariableSequenceSymmetryImp<View>
-  ::VariableSequenceSymmetryImp(Space& home, int* _indices, unsigned int n,
+  ::VariableSequenceSymmetryImp(Space&, int* _indices, unsigned int n,
                                 unsigned int seqsize)
-    : n_indices(n), seq_size(seqsize), n_seqs(n/seqsize) {
-    indices = home.alloc<unsigned int>(n_indices);
-    unsigned int max_index = _indices[0];
-    for (unsigned int i = 0 ; i < n_indices ; i++) {
-      indices[i] = _indices[i];
-      if (indices[i] > max_index)
-        max_index = indices[i];
-    }
-
-    lookup_size = max_index+1;
-    lookup = home.alloc<int>(lookup_size);
-    for (unsigned int i = 0 ; i < lookup_size ; i++)
-      lookup[i] = -1;
-    for (unsigned int i = 0 ; i < n_indices ; i++) {
-      if (lookup[indices[i]] == -1)
-        lookup[indices[i]] = i;
-    }
-  }
+    : indices(_indices, static_cast<int>(n), static_cast<int>(seqsize)) {}
 
   template <class View>
   VariableSequenceSymmetryImp<View>
-  ::VariableSequenceSymmetryImp(Space& home,
+  ::VariableSequenceSymmetryImp(Space&,
                                 const VariableSequenceSymmetryImp& s)
-    : n_indices(s.n_indices), seq_size(s.seq_size), n_seqs(s.n_seqs),
-      lookup_size(s.lookup_size) {
-    indices = home.alloc<unsigned int>(n_indices);
-    memcpy(indices, s.indices, n_indices * sizeof(int));
-    lookup = home.alloc<int>(lookup_size);
-    memcpy(lookup, s.lookup, lookup_size * sizeof(int));
-  }
+    : indices(s.indices) {}
 
   template <class View>
   size_t
   VariableSequenceSymmetryImp<View>
-  ::dispose(Space& home) {
-    home.free<unsigned int>(indices, n_indices);
-    home.free<int>(lookup, lookup_size);
+  ::dispose(Space&) {
+    indices.~SequenceTable();
     return sizeof(*this);
   }
 
   /// Compute symmetric literals
   template <class View>
-  ArgArray<Literal>
+  void
   VariableSequenceSymmetryImp<View>
-  ::symmetric(Literal l, const ViewArray<View>& x) const {
-    Region region;
-    Support::DynamicStack<Literal,Region> s(region);
-    if (l._variable < (int)lookup_size) {
-      int posIt = lookup[l._variable];
-      if (posIt == -1) {
-        return dynamicStackToArgArray(s);
-      }
-      unsigned int seqNum = posIt / seq_size;
-      unsigned int seqPos = posIt % seq_size;
-      for (unsigned int seq = 0 ; seq < n_seqs ; seq++) {
-        if (seq == seqNum) {
-          continue;
-        }
-        if (x[getVal(seq, seqPos)].assigned()) {
-          continue;
-        }
-        bool active = true;
-        const unsigned int *firstSeq = &indices[seqNum*seq_size];
-        const unsigned int *secondSeq = &indices[seq*seq_size];
-        for (unsigned int i = 0 ; i < seq_size ; i++) {
-          const View& xv = x[firstSeq[i]];
-          const View& yv = x[secondSeq[i]];
-          if ((!xv.assigned() && !yv.assigned())
-              || (xv.assigned() && yv.assigned() && xv.val() == yv.val())) {
-            continue;
-          } else {
-            active = false;
-            break;
-          }
-        }
-
-        if (active) {
-          s.push(Literal(secondSeq[seqPos], l._value));
+  ::symmetric(Literal l, const ViewArray<View>& x, LiteralStack& s) const {
+    int posIt = indices.first(l._variable);
+    if (posIt == -1)
+      return;
+    int seq_size = indices.seq_size();
+    int seqNum = posIt / seq_size;
+    int seqPos = posIt % seq_size;
+    const int* firstSeq = indices.seq(seqNum);
+    for (int seq = 0 ; seq < indices.n_seqs() ; seq++) {
+      if (seq == seqNum)
+        continue;
+      const int* secondSeq = indices.seq(seq);
+      if (x[secondSeq[seqPos]].assigned())
+        continue;
+      bool active = true;
+      for (int i = 0 ; i < seq_size ; i++) {
+        const View& xv = x[firstSeq[i]];
+        const View& yv = x[secondSeq[i]];
+        if (!((!xv.assigned() && !yv.assigned())
+              || (xv.assigned() && yv.assigned() && xv.val() == yv.val()))) {
+          active = false;
+          break;
         }
       }
+      if (active)
+        s.push(Literal(secondSeq[seqPos], l._value));
     }
-    return dynamicStackToArgArray(s);
   }
 
 
@@ -281,42 +303,26 @@ namespace Gecode { namespace Int { namespace LDSB {
 
 
 
-  template <class View>
-  int
-  ValueSequenceSymmetryImp<View>
-  ::getVal(unsigned int sequence, unsigned int position) const {
-    return values[sequence*seq_size + position];
-  }
-
   template <class View>
   ValueSequenceSymmetryImp<View>
   ::ValueSequenceSymmetryImp(Space& home, int* _values, unsigned int n,
                              unsigned int seqsize)
-    : n_values(n), seq_size(seqsize), n_seqs(n/seqsize),
-      dead_sequences(home, n_seqs) {
-    values = home.alloc<int>(n_values);
-    for (unsigned int i = 0 ; i < n_values ; i++)
-      values[i] = _values[i];
-  }
+    : values(_values, static_cast<int>(n), static_cast<int>(seqsize)),
+      dead_sequences(home, n/seqsize) {}
 
   template <class View>
   ValueSequenceSymmetryImp<View>
   ::ValueSequenceSymmetryImp(Space& home,
                              const ValueSequenceSymmetryImp<View>& vss)
-    : n_values(vss.n_values),
-      seq_size(vss.seq_size),
-      n_seqs(vss.n_seqs),
-      dead_sequences(home, vss.dead_sequences) {
-    values = home.alloc<int>(n_values);
-    for (unsigned int i = 0 ; i < n_values ; i++)
-      values[i] = vss.values[i];
-  }
+    : values(vss.values),
+      dead_sequences(home, vss.dead_sequences) {}
 
   template <class View>
   size_t
   ValueSequenceSymmetryImp<View>
   ::dispose(Space& home) {
-    home.free(values, n_values);
+    dead_sequences.dispose(home);
+    values.~SequenceTable();
     return sizeof(*this);
   }
 
@@ -324,23 +330,26 @@ namespace Gecode { namespace Int { namespace LDSB {
   void
   ValueSequenceSymmetryImp<View>
   ::update(Literal l) {
-    unsigned int seq = 0;
-    unsigned int pos = 0;
-    for (unsigned int i = 0 ; i < n_values ; i++) {
-      if (values[i] == l._value) {
-        dead_sequences.set(seq);
-        // TODO: This can be slightly optimised.
-        while (pos < seq_size) {
-          i++;
-          pos++;
-        }
-      }
-      pos++;
-      if (pos == seq_size) {
-        pos = 0;
-        seq++;
-      }
-    }
+    // Every sequence containing the value becomes dead
+    for (int p = values.first(l._value) ; p != -1 ; p = values.next(p))
+      dead_sequences.set(static_cast<unsigned int>(p / values.seq_size()));
+  }
+
+  template <class View>
+  void
+  ValueSequenceSymmetryImp<View>
+  ::symmetric(Literal l, const ViewArray<View>&, LiteralStack& s) const {
+    int p = values.first(l._value);
+    if (p == -1)
+      return;
+    int seqNum = p / values.seq_size();
+    int seqPos = p % values.seq_size();
+    if (dead_sequences.get(static_cast<unsigned int>(seqNum)))
+      return;
+    for (int seq = 0 ; seq < values.n_seqs() ; seq++)
+      if ((seq != seqNum) &&
+          !dead_sequences.get(static_cast<unsigned int>(seq)))
+        s.push(Literal(l._variable, values(seq,seqPos)));
   }
 
   template <class View>
@@ -99,6 +99,8 @@ namespace Gecode {
     const double rescale = 1e-50;
     /// Rescale action and afc values when larger than this
     const double rescale_limit = DBL_MAX * rescale;
+    /// Maximal number of failures a thread defers before merging afc values
+    const unsigned int afc_merge_max = 1024U;
 
     /// Initial value for alpha in CHB
     const double chb_alpha_init = 0.4;
@@ -108,6 +110,11 @@ namespace Gecode {
     const double chb_alpha_decrement = 1e-6;
     /// Initial value for Q-score in CHB
     const double chb_qscore_init = 0.05;
+
+    /// Minimal number of unassigned views for heap-based view selection
+    const int view_sel_heap_limit = 64;
+    /// Minimal number of views for which a brancher keeps unassigned views
+    const int view_compact_limit = 128;
   }}
 
 }
@@ -228,12 +235,15 @@ namespace Gecode {
 #include <gecode/kernel/branch/action.hpp>
 #include <gecode/kernel/branch/afc.hpp>
 #include <gecode/kernel/branch/chb.hpp>
+#include <gecode/kernel/branch/phase.hpp>
+#include <gecode/kernel/branch/conflict.hpp>
 #include <gecode/kernel/branch/var.hpp>
 #include <gecode/kernel/branch/val.hpp>
 #include <gecode/kernel/branch/tiebreak.hpp>
 #include <gecode/kernel/branch/merit.hpp>
 #include <gecode/kernel/branch/filter.hpp>
 #include <gecode/kernel/branch/view-sel.hpp>
+#include <gecode/kernel/branch/view-sel-heap.hpp>
 #include <gecode/kernel/branch/print.hpp>
 #include <gecode/kernel/branch/view.hpp>
 #include <gecode/kernel/branch/val-sel.hpp>
@@ -283,6 +293,7 @@ namespace Gecode {
 }
 
 #include <gecode/kernel/trace/general.hpp>
+#include <gecode/kernel/trace/sampler.hpp>
 
 /*
  * Allocator support
@@ -154,6 +154,12 @@ namespace Gecode {
     Action a;
     /// The advisor council
     Council<Idx> c;
+    /// Advisors marked since the last propagation
+    Idx** ma;
+    /// Number of marked advisors
+    int n_ma;
+    /// Mark advisor \a a and remember it for the next propagation
+    void mark(Idx& a);
     /// Constructor for cloning \a p
     Recorder(Space& home, Recorder<View>& p);
   public:
@@ -232,7 +238,8 @@ namespace Gecode {
   forceinline
   Action::Recorder<View>::Recorder(Home home, ViewArray<View>& x,
                                    Action& a0)
-    : NaryPropagator<View,PC_GEN_NONE>(home,x), a(a0), c(home) {
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), a(a0), c(home),
+      ma(static_cast<Space&>(home).alloc<Idx*>(x.size())), n_ma(0) {
     home.notice(*this,AP_DISPOSE);
     for (int i=0; i<x.size(); i++)
       if (!x[i].assigned())
@@ -363,8 +370,21 @@ namespace Gecode {
   template<class View>
   forceinline
   Action::Recorder<View>::Recorder(Space& home, Recorder<View>& p)
-    : NaryPropagator<View,PC_GEN_NONE>(home,p), a(p.a) {
+    : NaryPropagator<View,PC_GEN_NONE>(home,p), a(p.a),
+      ma(home.alloc<Idx*>(x.size())), n_ma(0) {
     c.update(home, p.c);
+    // Advisors can still be marked if the recorder is disabled
+    for (Advisors<Idx> as(c); as(); ++as)
+      if (as.advisor().marked())
+        ma[n_ma++] = &as.advisor();
+  }
+
+  template<class View>
+  forceinline void
+  Action::Recorder<View>::mark(Idx& a) {
+    if (!a.marked()) {
+      a.mark(); ma[n_ma++] = &a;
+    }
   }
 
   template<class View>
@@ -383,6 +403,7 @@ namespace Gecode {
     for (Advisors<Idx> as(c); as(); ++as)
       x[as.advisor().idx()].cancel(home,as.advisor(),true);
     c.dispose(home);
+    home.free<Idx*>(ma,x.size());
     (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
     return sizeof(*this);
   }
@@ -402,14 +423,14 @@ namespace Gecode {
   template<class View>
   ExecStatus
   Action::Recorder<View>::advise(Space&, Advisor& a, const Delta&) {
-    static_cast<Idx&>(a).mark();
+    mark(static_cast<Idx&>(a));
     return ES_NOFIX;
   }
 
   template<class View>
   void
   Action::Recorder<View>::advise(Space&, Advisor& a) {
-    static_cast<Idx&>(a).mark();
+    mark(static_cast<Idx&>(a));
   }
 
   template<class View>
@@ -417,15 +438,16 @@ namespace Gecode {
   Action::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
     // Lock action information
     a.acquire();
-    for (Advisors<Idx> as(c); as(); ++as) {
-      int i = as.advisor().idx();
-      if (as.advisor().marked()) {
-        as.advisor().unmark();
-        a.update(i);
-        if (x[i].assigned())
-          as.advisor().dispose(home,c);
-      }
+    // Only visit the advisors marked since the last propagation
+    for (int j=0; j<n_ma; j++) {
+      Idx& m = *ma[j];
+      int i = m.idx();
+      m.unmark();
+      a.update(i);
+      if (x[i].assigned())
+        m.dispose(home,c);
     }
+    n_ma = 0;
     a.release();
     return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
   }
@@ -164,6 +164,12 @@ namespace Gecode {
     CHB chb;
     /// The advisor council
     Council<Idx> c;
+    /// Advisors marked since the last propagation
+    Idx** ma;
+    /// Number of marked advisors
+    int n_ma;
+    /// Mark advisor \a a and remember it for the next propagation
+    void mark(Idx& a);
     /// Constructor for cloning \a p
     Recorder(Space& home, Recorder<View>& p);
   public:
@@ -242,7 +248,8 @@ namespace Gecode {
   forceinline
   CHB::Recorder<View>::Recorder(Home home, ViewArray<View>& x,
                                 CHB& chb0)
-    : NaryPropagator<View,PC_GEN_NONE>(home,x), chb(chb0), c(home) {
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), chb(chb0), c(home),
+      ma(static_cast<Space&>(home).alloc<Idx*>(x.size())), n_ma(0) {
     home.notice(*this,AP_DISPOSE);
     for (int i=0; i<x.size(); i++)
       if (!x[i].assigned())
@@ -386,8 +393,21 @@ namespace Gecode {
   template<class View>
   forceinline
   CHB::Recorder<View>::Recorder(Space& home, Recorder<View>& p)
-    : NaryPropagator<View,PC_GEN_NONE>(home,p), chb(p.chb) {
+    : NaryPropagator<View,PC_GEN_NONE>(home,p), chb(p.chb),
+      ma(home.alloc<Idx*>(x.size())), n_ma(0) {
     c.update(home, p.c);
+    // Advisors can still be marked if the recorder is disabled
+    for (Advisors<Idx> as(c); as(); ++as)
+      if (as.advisor().marked())
+        ma[n_ma++] = &as.advisor();
+  }
+
+  template<class View>
+  forceinline void
+  CHB::Recorder<View>::mark(Idx& a) {
+    if (!a.marked()) {
+      a.mark(); ma[n_ma++] = &a;
+    }
   }
 
   template<class View>
@@ -406,6 +426,7 @@ namespace Gecode {
     for (Advisors<Idx> as(c); as(); ++as)
       x[as.advisor().idx()].cancel(home,as.advisor(),true);
     c.dispose(home);
+    home.free<Idx*>(ma,x.size());
     (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
     return sizeof(*this);
   }
@@ -425,14 +446,14 @@ namespace Gecode {
   template<class View>
   ExecStatus
   CHB::Recorder<View>::advise(Space&, Advisor& a, const Delta&) {
-    static_cast<Idx&>(a).mark();
+    mark(static_cast<Idx&>(a));
     return ES_NOFIX;
   }
 
   template<class View>
   void
   CHB::Recorder<View>::advise(Space&, Advisor& a) {
-    static_cast<Idx&>(a).mark();
+    mark(static_cast<Idx&>(a));
   }
 
   template<class View>
@@ -440,28 +461,19 @@ namespace Gecode {
   CHB::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
     // Lock chb information
     chb.acquire();
-    if (home.failed()) {
+    bool failed = home.failed();
+    if (failed)
       chb.bump();
-      for (Advisors<Idx> as(c); as(); ++as) {
-        int i = as.advisor().idx();
-        if (as.advisor().marked()) {
-          as.advisor().unmark();
-          chb.update(i,true);
-          if (x[i].assigned())
-            as.advisor().dispose(home,c);
-        }
-      }
-    } else {
-      for (Advisors<Idx> as(c); as(); ++as) {
-        int i = as.advisor().idx();
-        if (as.advisor().marked()) {
-          as.advisor().unmark();
-          chb.update(i,false);
-          if (x[i].assigned())
-            as.advisor().dispose(home,c);
-        }
-      }
+    // Only visit the advisors marked since the last propagation
+    for (int j=0; j<n_ma; j++) {
+      Idx& m = *ma[j];
+      int i = m.idx();
+      m.unmark();
+      chb.update(i,failed);
+      if (x[i].assigned())
+        m.dispose(home,c);
     }
+    n_ma = 0;
     chb.release();
     return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
   }
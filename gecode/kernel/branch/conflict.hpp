@@ -0,0 +1,417 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Class for conflict management
+   *
+   * A variable is in conflict if a failure occurs after it has been
+   * branched on (more precisely, if it has been the first variable
+   * to be modified after the last fixpoint). Each failure receives a
+   * time stamp and the conflict value of a variable is the time stamp
+   * of its most recent conflict (or zero if it has not been in conflict).
+   *
+   * If the number of conflict variables \f$k\f$ is zero, the conflict
+   * value is defined for all variables which yields conflict-ordering
+   * search. Otherwise, only the \f$k\f$ variables most recently in
+   * conflict have a non-zero conflict value which yields last-conflict
+   * reasoning LC(\f$k\f$).
+   *
+   * The ideas are taken from: Reasoning from last conflict(s) in
+   * constraint programming, Christophe Lecoutre, Lakhdar Sais,
+   * Sebastien Tabary, Vincent Vidal, Artificial Intelligence 173(18),
+   * 2009, pages 1592-1614, and from: Conflict ordering search for
+   * scheduling problems, Steven Gay, Renaud Hartert, Christophe
+   * Lecoutre, Pierre Schaus, CP 2015, pages 140-148.
+   *
+   * \ingroup TaskBranchViewVal
+   */
+  class Conflict : public SharedHandle {
+  protected:
+    template<class View>
+    class Recorder;
+    /// Object for storing conflict information
+    class GECODE_VTABLE_EXPORT Storage : public SharedHandle::Object {
+    public:
+      /// Mutex to synchronize globally shared access
+      GECODE_KERNEL_EXPORT static Support::Mutex m;
+      /// Number of conflict values
+      int n;
+      /// Number of conflict variables (zero for all)
+      int k;
+      /// Number of failures
+      unsigned long long int nf;
+      /// Most recent failure for each variable
+      unsigned long long int* lf;
+      /// Variables most recently in conflict (most recent first)
+      int* r;
+      /// Number of variables most recently in conflict
+      int n_r;
+      /// Initialize for \a n variables and \a k conflict variables
+      Storage(int n, int k);
+      /// Delete object
+      GECODE_KERNEL_EXPORT
+      ~Storage(void);
+      /// Record failure for variable at position \a i
+      void update(int i);
+      /// Return conflict value at position \a i
+      double value(int i) const;
+    };
+    /// Return object of correct type
+    Storage& object(void) const;
+    /// Set object to \a o
+    void object(Storage& o);
+    /// Record failure for variable at position \a i
+    void update(int i);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized conflict storage is init and the assignment operator.
+     *
+     */
+    Conflict(void);
+    /// Copy constructor
+    GECODE_KERNEL_EXPORT
+    Conflict(const Conflict& c);
+    /// Assignment operator
+    GECODE_KERNEL_EXPORT
+    Conflict& operator =(const Conflict& c);
+    /// Initialize for views \a x and \a k conflict variables
+    template<class View>
+    Conflict(Home home, ViewArray<View>& x, int k);
+    /// Initialize for views \a x and \a k conflict variables
+    template<class View>
+    void init(Home home, ViewArray<View>& x, int k);
+    /// Default (empty) conflict information
+    GECODE_KERNEL_EXPORT static const Conflict def;
+    //@}
+
+    /// Destructor
+    GECODE_KERNEL_EXPORT
+    ~Conflict(void);
+
+    /// \name Information access
+    //@{
+    /// Return conflict value at position \a i
+    double operator [](int i) const;
+    /// Return number of conflict values
+    int size(void) const;
+    //@}
+  };
+
+  /// Propagator for recording conflict information
+  template<class View>
+  class Conflict::Recorder : public NaryPropagator<View,PC_GEN_NONE> {
+  protected:
+    using NaryPropagator<View,PC_GEN_NONE>::x;
+    /// Advisor with index information
+    class Idx : public Advisor {
+    protected:
+      /// Index of view
+      int _idx;
+    public:
+      /// Constructor for creation
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Constructor for cloning \a a
+      Idx(Space& home, Idx& a);
+      /// Get index of view
+      int idx(void) const;
+    };
+    /// Access to conflict information
+    Conflict cfl;
+    /// The advisor council
+    Council<Idx> c;
+    /// Index of first view modified after last fixpoint (-1 if none)
+    int d;
+    /// Constructor for cloning \a p
+    Recorder(Space& home, Recorder<View>& p);
+  public:
+    /// Constructor for creation
+    Recorder(Home home, ViewArray<View>& x, Conflict& cfl);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home);
+    /// Cost function (record so that propagator runs last)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post conflict recorder propagator
+    static ExecStatus post(Home home, ViewArray<View>& x, Conflict& cfl);
+  };
+
+  /**
+   * \brief Print conflict values enclosed in curly brackets
+   * \relates Conflict
+   */
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+             const Conflict& c);
+
+
+  /*
+   * Advisor for conflict recorder
+   *
+   */
+  template<class View>
+  forceinline
+  Conflict::Recorder<View>::Idx::Idx(Space& home, Propagator& p,
+                                     Council<Idx>& c, int i)
+    : Advisor(home,p,c), _idx(i) {}
+  template<class View>
+  forceinline
+  Conflict::Recorder<View>::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), _idx(a._idx) {
+  }
+  template<class View>
+  forceinline int
+  Conflict::Recorder<View>::Idx::idx(void) const {
+    return _idx;
+  }
+
+
+  /*
+   * Posting of conflict recorder propagator
+   *
+   */
+  template<class View>
+  forceinline
+  Conflict::Recorder<View>::Recorder(Home home, ViewArray<View>& x,
+                                     Conflict& cfl0)
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), cfl(cfl0), c(home), d(-1) {
+    home.notice(*this,AP_DISPOSE);
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned())
+        x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  Conflict::Recorder<View>::post(Home home, ViewArray<View>& x,
+                                 Conflict& cfl) {
+    (void) new (home) Recorder<View>(home,x,cfl);
+    return ES_OK;
+  }
+
+
+  /*
+   * Conflict storage
+   *
+   */
+  forceinline
+  Conflict::Storage::Storage(int n0, int k0)
+    : n(n0), k(k0), nf(0ULL),
+      lf(heap.alloc<unsigned long long int>(n0)),
+      r((k0 > 0) ? heap.alloc<int>(k0) : NULL), n_r(0) {
+    for (int i=0; i<n; i++)
+      lf[i] = 0ULL;
+  }
+  forceinline void
+  Conflict::Storage::update(int i) {
+    lf[i] = ++nf;
+    if (k > 0) {
+      // Move i to the front of the most recent conflict variables
+      int j = 0;
+      while ((j < n_r) && (r[j] != i))
+        j++;
+      if (j == n_r) {
+        if (n_r < k)
+          n_r++;
+        j = n_r-1;
+      }
+      for (; j>0; j--)
+        r[j] = r[j-1];
+      r[0] = i;
+    }
+  }
+  forceinline double
+  Conflict::Storage::value(int i) const {
+    // The most recent conflict variables have the largest time stamps
+    if ((k == 0) || (n_r < k) || (lf[i] >= lf[r[k-1]]))
+      return static_cast<double>(lf[i]);
+    return 0.0;
+  }
+
+
+  /*
+   * Conflict
+   *
+   */
+
+  forceinline Conflict::Storage&
+  Conflict::object(void) const {
+    return static_cast<Conflict::Storage&>(*SharedHandle::object());
+  }
+
+  forceinline void
+  Conflict::object(Conflict::Storage& o) {
+    SharedHandle::object(&o);
+  }
+
+  forceinline void
+  Conflict::update(int i) {
+    assert((i >= 0) && (i < object().n));
+    object().m.acquire();
+    object().update(i);
+    object().m.release();
+  }
+  forceinline double
+  Conflict::operator [](int i) const {
+    assert((i >= 0) && (i < object().n));
+    return object().value(i);
+  }
+  forceinline int
+  Conflict::size(void) const {
+    return object().n;
+  }
+
+
+  forceinline
+  Conflict::Conflict(void) {}
+
+  template<class View>
+  forceinline
+  Conflict::Conflict(Home home, ViewArray<View>& x, int k) {
+    assert(!*this);
+    if (k < 0)
+      throw IllegalConflict("Conflict::Conflict");
+    object(*new Storage(x.size(),k));
+    (void) Recorder<View>::post(home,x,*this);
+  }
+  template<class View>
+  forceinline void
+  Conflict::init(Home home, ViewArray<View>& x, int k) {
+    assert(!*this);
+    if (k < 0)
+      throw IllegalConflict("Conflict::init");
+    object(*new Storage(x.size(),k));
+    (void) Recorder<View>::post(home,x,*this);
+  }
+
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+              const Conflict& c) {
+    std::basic_ostringstream<Char,Traits> s;
+    s.copyfmt(os); s.width(0);
+    s << '{';
+    if (c.size() > 0) {
+      s << c[0];
+      for (int i=1; i<c.size(); i++)
+        s << ", " << c[i];
+    }
+    s << '}';
+    return os << s.str();
+  }
+
+
+  /*
+   * Propagation for conflict recorder
+   *
+   */
+  template<class View>
+  forceinline
+  Conflict::Recorder<View>::Recorder(Space& home, Recorder<View>& r)
+    : NaryPropagator<View,PC_GEN_NONE>(home,r), cfl(r.cfl), d(r.d) {
+    c.update(home, r.c);
+  }
+
+  template<class View>
+  Propagator*
+  Conflict::Recorder<View>::copy(Space& home) {
+    return new (home) Recorder<View>(home, *this);
+  }
+
+  template<class View>
+  inline size_t
+  Conflict::Recorder<View>::dispose(Space& home) {
+    // Delete access to conflict information
+    home.ignore(*this,AP_DISPOSE);
+    cfl.~Conflict();
+    // Cancel remaining advisors
+    for (Advisors<Idx> as(c); as(); ++as)
+      x[as.advisor().idx()].cancel(home,as.advisor());
+    c.dispose(home);
+    (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  PropCost
+  Conflict::Recorder<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::record();
+  }
+
+  template<class View>
+  void
+  Conflict::Recorder<View>::reschedule(Space& home) {
+    View::schedule(home,*this,ME_GEN_ASSIGNED);
+  }
+
+  template<class View>
+  ExecStatus
+  Conflict::Recorder<View>::advise(Space& home, Advisor& a, const Delta&) {
+    Idx& i = static_cast<Idx&>(a);
+    bool first = (d < 0);
+    // The first view modified after a fixpoint is the one branched on
+    if (first)
+      d = i.idx();
+    if (x[i.idx()].assigned())
+      i.dispose(home,c);
+    // Run the recorder for the first modification only
+    return first ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class View>
+  ExecStatus
+  Conflict::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
+    // The recorder also runs when home has failed
+    if (home.failed() && (d >= 0))
+      cfl.update(d);
+    d = -1;
+    return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}
+
+// STATISTICS: kernel-branch
@@ -167,6 +167,28 @@ namespace Gecode {
     /// Dispose view selection
     void dispose(Space& home);
   };
+
+  /**
+   * \brief Merit class for conflicts
+   */
+  template<class View>
+  class MeritConflict : public MeritBase<View,double> {
+    using typename MeritBase<View,double>::Var;
+  protected:
+    /// Conflict information
+    Conflict cfl;
+  public:
+    /// Constructor for initialization
+    MeritConflict(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for cloning
+    MeritConflict(Space& home, MeritConflict& mc);
+    /// Return most recent conflict as merit for view \a x at position \a i
+    double operator ()(const Space& home, View x, int i);
+    /// Whether dispose must always be called (that is, notice is needed)
+    bool notice(void) const;
+    /// Dispose view selection
+    void dispose(Space& home);
+  };
   //@}
 
 
@@ -316,6 +338,32 @@ namespace Gecode {
     chb.~CHB();
   }
 
+  // Conflict merit
+  template<class View>
+  forceinline
+  MeritConflict<View>::MeritConflict
+    (Space& home, const VarBranch<MeritConflict<View>::Var>& vb)
+    : MeritBase<View,double>(home,vb), cfl(vb.conflict()) {}
+  template<class View>
+  forceinline
+  MeritConflict<View>::MeritConflict(Space& home, MeritConflict& mc)
+    : MeritBase<View,double>(home,mc), cfl(mc.cfl) {}
+  template<class View>
+  forceinline double
+  MeritConflict<View>::operator ()(const Space&, View, int i) {
+    return cfl[i];
+  }
+  template<class View>
+  forceinline bool
+  MeritConflict<View>::notice(void) const {
+    return true;
+  }
+  template<class View>
+  forceinline void
+  MeritConflict<View>::dispose(Space&) {
+    cfl.~Conflict();
+  }
+
 }
 
 // STATISTICS: kernel-branch
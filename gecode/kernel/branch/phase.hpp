@@ -0,0 +1,357 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Class for phase management
+   *
+   * The phase of a variable is the value the variable has been assigned
+   * to most recently, no matter whether by branching or by propagation.
+   * As the phase information is shared by all clones, the phases of a
+   * solution remain available for search after restarts and after new
+   * solutions have been found. Phase information can only be used for
+   * views with integer values.
+   *
+   * \ingroup TaskBranchViewVal
+   */
+  class Phase : public SharedHandle {
+  protected:
+    template<class View>
+    class Recorder;
+    /// Object for storing phase information
+    class GECODE_VTABLE_EXPORT Storage : public SharedHandle::Object {
+    public:
+      /// Mutex to synchronize globally shared access
+      GECODE_KERNEL_EXPORT static Support::Mutex m;
+      /// Number of phases
+      int n;
+      /// Phases
+      int* p;
+      /// Initialize phases with smallest values of views \a x
+      template<class View>
+      Storage(Home home, ViewArray<View>& x);
+      /// Delete object
+      GECODE_KERNEL_EXPORT
+      ~Storage(void);
+    };
+    /// Return object of correct type
+    Storage& object(void) const;
+    /// Set object to \a o
+    void object(Storage& o);
+    /// Update phase at position \a i to \a v
+    void update(int i, int v);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /**
+     * \brief Construct as not yet intialized
+     *
+     * The only member functions that can be used on a constructed but not
+     * yet initialized phase storage is init and the assignment operator.
+     *
+     */
+    Phase(void);
+    /// Copy constructor
+    GECODE_KERNEL_EXPORT
+    Phase(const Phase& p);
+    /// Assignment operator
+    GECODE_KERNEL_EXPORT
+    Phase& operator =(const Phase& p);
+    /// Initialize for views \a x
+    template<class View>
+    Phase(Home home, ViewArray<View>& x);
+    /// Initialize for views \a x
+    template<class View>
+    void init(Home home, ViewArray<View>& x);
+    /// Default (empty) phase information
+    GECODE_KERNEL_EXPORT static const Phase def;
+    //@}
+
+    /// Destructor
+    GECODE_KERNEL_EXPORT
+    ~Phase(void);
+
+    /// \name Information access
+    //@{
+    /// Return phase at position \a i
+    int operator [](int i) const;
+    /// Return number of phases
+    int size(void) const;
+    //@}
+  };
+
+  /// Propagator for recording phase information
+  template<class View>
+  class Phase::Recorder : public NaryPropagator<View,PC_GEN_NONE> {
+  protected:
+    using NaryPropagator<View,PC_GEN_NONE>::x;
+    /// Advisor with index information
+    class Idx : public Advisor {
+    protected:
+      /// Index of view
+      int _idx;
+    public:
+      /// Constructor for creation
+      Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+      /// Constructor for cloning \a a
+      Idx(Space& home, Idx& a);
+      /// Get index of view
+      int idx(void) const;
+    };
+    /// Access to phase information
+    Phase p;
+    /// The advisor council
+    Council<Idx> c;
+    /// Constructor for cloning \a p
+    Recorder(Space& home, Recorder<View>& p);
+  public:
+    /// Constructor for creation
+    Recorder(Home home, ViewArray<View>& x, Phase& p);
+    /// Copy propagator during cloning
+    virtual Propagator* copy(Space& home);
+    /// Cost function (record so that propagator runs last)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post phase recorder propagator
+    static ExecStatus post(Home home, ViewArray<View>& x, Phase& p);
+  };
+
+  /**
+   * \brief Print phases enclosed in curly brackets
+   * \relates Phase
+   */
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+             const Phase& p);
+
+
+  /*
+   * Advisor for phase recorder
+   *
+   */
+  template<class View>
+  forceinline
+  Phase::Recorder<View>::Idx::Idx(Space& home, Propagator& p,
+                                  Council<Idx>& c, int i)
+    : Advisor(home,p,c), _idx(i) {}
+  template<class View>
+  forceinline
+  Phase::Recorder<View>::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), _idx(a._idx) {
+  }
+  template<class View>
+  forceinline int
+  Phase::Recorder<View>::Idx::idx(void) const {
+    return _idx;
+  }
+
+
+  /*
+   * Posting of phase recorder propagator
+   *
+   */
+  template<class View>
+  forceinline
+  Phase::Recorder<View>::Recorder(Home home, ViewArray<View>& x,
+                                  Phase& p0)
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), p(p0), c(home) {
+    home.notice(*this,AP_DISPOSE);
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned())
+        x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  Phase::Recorder<View>::post(Home home, ViewArray<View>& x, Phase& p) {
+    (void) new (home) Recorder<View>(home,x,p);
+    return ES_OK;
+  }
+
+
+  /*
+   * Phase storage
+   *
+   */
+
+  template<class View>
+  forceinline
+  Phase::Storage::Storage(Home, ViewArray<View>& x)
+    : n(x.size()), p(heap.alloc<int>(x.size())) {
+    for (int i=0; i<n; i++)
+      p[i] = x[i].min();
+  }
+
+
+  /*
+   * Phase
+   *
+   */
+
+  forceinline Phase::Storage&
+  Phase::object(void) const {
+    return static_cast<Phase::Storage&>(*SharedHandle::object());
+  }
+
+  forceinline void
+  Phase::object(Phase::Storage& o) {
+    SharedHandle::object(&o);
+  }
+
+  forceinline void
+  Phase::update(int i, int v) {
+    assert((i >= 0) && (i < object().n));
+    object().m.acquire();
+    object().p[i] = v;
+    object().m.release();
+  }
+  forceinline int
+  Phase::operator [](int i) const {
+    assert((i >= 0) && (i < object().n));
+    return object().p[i];
+  }
+  forceinline int
+  Phase::size(void) const {
+    return object().n;
+  }
+
+
+  forceinline
+  Phase::Phase(void) {}
+
+  template<class View>
+  forceinline
+  Phase::Phase(Home home, ViewArray<View>& x) {
+    assert(!*this);
+    object(*new Storage(home,x));
+    (void) Recorder<View>::post(home,x,*this);
+  }
+  template<class View>
+  forceinline void
+  Phase::init(Home home, ViewArray<View>& x) {
+    assert(!*this);
+    object(*new Storage(home,x));
+    (void) Recorder<View>::post(home,x,*this);
+  }
+
+  template<class Char, class Traits>
+  std::basic_ostream<Char,Traits>&
+  operator <<(std::basic_ostream<Char,Traits>& os,
+              const Phase& p) {
+    std::basic_ostringstream<Char,Traits> s;
+    s.copyfmt(os); s.width(0);
+    s << '{';
+    if (p.size() > 0) {
+      s << p[0];
+      for (int i=1; i<p.size(); i++)
+        s << ", " << p[i];
+    }
+    s << '}';
+    return os << s.str();
+  }
+
+
+  /*
+   * Propagation for phase recorder
+   *
+   */
+  template<class View>
+  forceinline
+  Phase::Recorder<View>::Recorder(Space& home, Recorder<View>& r)
+    : NaryPropagator<View,PC_GEN_NONE>(home,r), p(r.p) {
+    c.update(home, r.c);
+  }
+
+  template<class View>
+  Propagator*
+  Phase::Recorder<View>::copy(Space& home) {
+    return new (home) Recorder<View>(home, *this);
+  }
+
+  template<class View>
+  inline size_t
+  Phase::Recorder<View>::dispose(Space& home) {
+    // Delete access to phase information
+    home.ignore(*this,AP_DISPOSE);
+    p.~Phase();
+    // Cancel remaining advisors
+    for (Advisors<Idx> as(c); as(); ++as)
+      x[as.advisor().idx()].cancel(home,as.advisor());
+    c.dispose(home);
+    (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  PropCost
+  Phase::Recorder<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::record();
+  }
+
+  template<class View>
+  void
+  Phase::Recorder<View>::reschedule(Space& home) {
+    if (c.empty())
+      View::schedule(home,*this,ME_GEN_ASSIGNED);
+  }
+
+  template<class View>
+  ExecStatus
+  Phase::Recorder<View>::advise(Space& home, Advisor& a, const Delta&) {
+    Idx& i = static_cast<Idx&>(a);
+    if (!x[i.idx()].assigned())
+      return ES_FIX;
+    p.update(i.idx(),x[i.idx()].val());
+    i.dispose(home,c);
+    // Only run the recorder to become subsumed
+    return c.empty() ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class View>
+  ExecStatus
+  Phase::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
+    return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}
+
+// STATISTICS: kernel-branch
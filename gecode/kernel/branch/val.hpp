@@ -51,6 +51,8 @@ namespace Gecode {
     BranchVal vf;
     /// Commit function
     BranchCommit cf;
+    /// Phase information
+    Phase _ph;
   public:
     /// Initialize
     ValBranch(void);
@@ -58,12 +60,18 @@ namespace Gecode {
     ValBranch(Rnd r);
     /// Initialize with value function \a v and commit function \a c
     ValBranch(BranchVal v, BranchCommit c);
+    /// Initialize with phase information \a p
+    ValBranch(Phase p);
     /// Return random number generator
     Rnd rnd(void) const;
     /// Return value function
     BranchVal val(void) const;
     /// Return commit function
     BranchCommit commit(void) const;
+    /// Return phase information
+    Phase phase(void) const;
+    /// Set phase information to \a p
+    void phase(Phase p);
   };
 
 
@@ -85,6 +93,14 @@ namespace Gecode {
   ValBranch<Var>::ValBranch(BranchVal v, BranchCommit c)
     : vf(v), cf(c) {}
 
+  template<class Var>
+  inline
+  ValBranch<Var>::ValBranch(Phase p)
+    : vf(nullptr), cf(nullptr), _ph(p) {
+    if (!_ph)
+      throw UninitializedPhase("ValBranch::ValBranch");
+  }
+
   template<class Var>
   inline Rnd
   ValBranch<Var>::rnd(void) const {
@@ -103,6 +119,18 @@ namespace Gecode {
     return cf;
   }
 
+  template<class Var>
+  inline Phase
+  ValBranch<Var>::phase(void) const {
+    return _ph;
+  }
+
+  template<class Var>
+  inline void
+  ValBranch<Var>::phase(Phase p) {
+    _ph = p;
+  }
+
 }
 
 // STATISTICS: kernel-branch
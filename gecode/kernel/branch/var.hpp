@@ -69,6 +69,10 @@ namespace Gecode {
     Action _act;
     /// CHB information
     CHB _chb;
+    /// Number of conflict variables
+    int _k;
+    /// Conflict information
+    Conflict _cfl;
     /// Merit function
     MeritFunction _mf;
   public:
@@ -86,6 +90,10 @@ namespace Gecode {
     VarBranch(Action a, BranchTbl t);
     /// Initialize with CHB \a c and tie-break limit function \a t
     VarBranch(CHB c, BranchTbl t);
+    /// Initialize with \a k conflict variables and tie-break limit function \a t
+    VarBranch(int k, BranchTbl t);
+    /// Initialize with conflict information \a c and tie-break limit function \a t
+    VarBranch(Conflict c, BranchTbl t);
     /// Initialize with merit function \a f and tie-break limit function \a t
     VarBranch(MeritFunction f, BranchTbl t);
     /// Return tie-break limit function
@@ -106,6 +114,12 @@ namespace Gecode {
     CHB chb(void) const;
     /// Set CHB to \a chb
     void chb(CHB chb);
+    /// Return number of conflict variables
+    int conflicts(void) const;
+    /// Return conflict information
+    Conflict conflict(void) const;
+    /// Set conflict information to \a c
+    void conflict(Conflict c);
     /// Return merit function
     MeritFunction merit(void) const;
   };
@@ -114,22 +128,22 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(void)
-    : _tbl(nullptr), _decay(1.0) {}
+    : _tbl(nullptr), _decay(1.0), _k(0) {}
 
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(BranchTbl t)
-    : _tbl(t), _decay(1.0) {}
+    : _tbl(t), _decay(1.0), _k(0) {}
 
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(double d, BranchTbl t)
-    : _tbl(t), _decay(d) {}
+    : _tbl(t), _decay(d), _k(0) {}
 
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(AFC a, BranchTbl t)
-    : _tbl(t), _decay(1.0), _afc(a) {
+    : _tbl(t), _decay(1.0), _afc(a), _k(0) {
     if (!_afc)
       throw UninitializedAFC("VarBranch<Var>::VarBranch");
   }
@@ -137,7 +151,7 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(Action a, BranchTbl t)
-    : _tbl(t), _decay(1.0), _act(a) {
+    : _tbl(t), _decay(1.0), _act(a), _k(0) {
     if (!_act)
       throw UninitializedAction("VarBranch<Var>::VarBranch");
   }
@@ -145,15 +159,31 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(CHB c, BranchTbl t)
-    : _tbl(t), _decay(1.0), _chb(c) {
+    : _tbl(t), _decay(1.0), _chb(c), _k(0) {
     if (!_chb)
       throw UninitializedCHB("VarBranch<Var>::VarBranch");
   }
 
+  template<class Var>
+  inline
+  VarBranch<Var>::VarBranch(int k, BranchTbl t)
+    : _tbl(t), _decay(1.0), _k(k) {
+    if (_k < 0)
+      throw IllegalConflict("VarBranch<Var>::VarBranch");
+  }
+
+  template<class Var>
+  inline
+  VarBranch<Var>::VarBranch(Conflict c, BranchTbl t)
+    : _tbl(t), _decay(1.0), _k(0), _cfl(c) {
+    if (!_cfl)
+      throw UninitializedConflict("VarBranch<Var>::VarBranch");
+  }
+
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(Rnd r)
-    : _tbl(nullptr), _rnd(r), _decay(1.0) {
+    : _tbl(nullptr), _rnd(r), _decay(1.0), _k(0) {
     if (!_rnd)
       throw UninitializedRnd("VarBranch<Var>::VarBranch");
   }
@@ -161,7 +191,7 @@ namespace Gecode {
   template<class Var>
   inline
   VarBranch<Var>::VarBranch(MeritFunction f, BranchTbl t)
-    : _tbl(t), _decay(1.0), _mf(f) {}
+    : _tbl(t), _decay(1.0), _k(0), _mf(f) {}
 
   template<class Var>
   inline BranchTbl
@@ -217,6 +247,24 @@ namespace Gecode {
     _chb=chb;
   }
 
+  template<class Var>
+  inline int
+  VarBranch<Var>::conflicts(void) const {
+    return _k;
+  }
+
+  template<class Var>
+  inline Conflict
+  VarBranch<Var>::conflict(void) const {
+    return _cfl;
+  }
+
+  template<class Var>
+  inline void
+  VarBranch<Var>::conflict(Conflict c) {
+    _cfl=c;
+  }
+
   template<class Var>
   inline typename VarBranch<Var>::MeritFunction
   VarBranch<Var>::merit(void) const {
@@ -0,0 +1,620 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode {
+
+  /**
+   * \brief Choose view according to merit maintained in a heap
+   *
+   * The merit must only depend on the domain of a view (such as
+   * its size, minimum, maximum, or regret). The heap is kept
+   * up-to-date by a recorder propagator whose advisors are informed
+   * about every domain change of a view. That makes selecting a view
+   * logarithmic rather than linear in the number of views.
+   *
+   * Ties are broken by the position of the view, hence the views
+   * selected are exactly the same as for ViewSelChoose. The heap
+   * is only created for arrays with at least
+   * Kernel::Config::view_sel_heap_limit unassigned views, for
+   * smaller arrays and for selection with a branch filter function
+   * the views are scanned as by ViewSelChoose.
+   *
+   * \ingroup TaskBranchViewSel
+   */
+  template<class Choose, class Merit>
+  class ViewSelChooseHeap : public ViewSelChoose<Choose,Merit> {
+  protected:
+    typedef typename ViewSelChoose<Choose,Merit>::Val Val;
+    typedef typename ViewSelChoose<Choose,Merit>::View View;
+    typedef typename ViewSelChoose<Choose,Merit>::Var Var;
+    using ViewSelChoose<Choose,Merit>::c;
+    using ViewSelChoose<Choose,Merit>::m;
+    /// Space-local heap of view positions ordered by merit
+    class Heap : public LocalObject {
+    public:
+      /// How to choose
+      Choose c;
+      /// The merit object used
+      Merit m;
+      /// Number of views
+      int n_x;
+      /// Number of views in heap
+      int n;
+      /// Positions of views in heap order
+      int* h;
+      /// Merit values in heap order
+      Val* v;
+      /// Heap index for view at position (-1 if not in heap)
+      int* p;
+      /// Initialize heap for views \a x starting from \a s
+      Heap(Space& home, Merit& m, ViewArray<View>& x, int s);
+      /// Constructor for cloning \a h
+      Heap(Space& home, Heap& h);
+      /// Copy during cloning
+      virtual Actor* copy(Space& home);
+      /// Test whether heap entry \a i is better than heap entry \a j
+      bool better(int i, int j) const;
+      /// Swap heap entries \a i and \a j
+      void swap(int i, int j);
+      /// Move heap entry \a i up
+      void up(int i);
+      /// Move heap entry \a i down
+      void down(int i);
+      /// Return position of best view
+      int top(void) const;
+      /// Update merit for view \a x at position \a i
+      void update(const Space& home, View x, int i);
+      /// Remove view at position \a i
+      void remove(int i);
+      /// Store positions of views with best merit in \a ties
+      void ties(int* ties, int& n_ties) const;
+    };
+    /// Handle to heap
+    class HeapHandle : public LocalHandle {
+    public:
+      /// Create handle to no heap
+      HeapHandle(void);
+      /// Create handle to heap \a h
+      HeapHandle(Heap* h);
+      /// Copy constructor
+      HeapHandle(const HeapHandle& hh);
+      /// Whether handle refers to a heap
+      operator bool(void) const;
+      /// Return heap
+      Heap& operator *(void) const;
+    };
+    /// Propagator for recording domain changes into the heap
+    class Recorder : public NaryPropagator<View,PC_GEN_NONE> {
+    protected:
+      using NaryPropagator<View,PC_GEN_NONE>::x;
+      /// Advisor with index information
+      class Idx : public Advisor {
+      protected:
+        /// Index of view
+        int _idx;
+      public:
+        /// Constructor for creation
+        Idx(Space& home, Propagator& p, Council<Idx>& c, int i);
+        /// Constructor for cloning \a a
+        Idx(Space& home, Idx& a);
+        /// Get index of view
+        int idx(void) const;
+      };
+      /// The heap
+      HeapHandle h;
+      /// The advisor council
+      Council<Idx> c;
+      /// Constructor for cloning \a p
+      Recorder(Space& home, Recorder& p);
+    public:
+      /// Constructor for creation
+      Recorder(Home home, ViewArray<View>& x, HeapHandle& h);
+      /// Copy propagator during cloning
+      virtual Propagator* copy(Space& home);
+      /// Cost function (record so that propagator runs last)
+      virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+      /// Schedule function
+      virtual void reschedule(Space& home);
+      /// Give advice to propagator
+      virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+      /// Perform propagation
+      virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+      /// Delete propagator and return its size
+      virtual size_t dispose(Space& home);
+    };
+    /// The heap (if initialized)
+    HeapHandle h;
+    /// Whether views are scanned as the array is too small
+    bool scan;
+    /// Return heap, initialize if needed and worthwhile
+    Heap* heap(Space& home, ViewArray<View>& x, int s);
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for creation
+    ViewSelChooseHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelChooseHeap(Space& home, ViewSelChooseHeap<Choose,Merit>& vs);
+    //@}
+    /// \name View selection and tie breaking
+    //@{
+    /// Select a view from \a x starting from \a s and return its position
+    virtual int select(Space& home, ViewArray<View>& x, int s);
+    /// Select a view from \a x starting from \a s and return its position
+    virtual int select(Space& home, ViewArray<View>& x, int s,
+                       BrancherFilter<View>& f);
+    /// Select ties from \a x starting from \a s
+    virtual void ties(Space& home, ViewArray<View>& x, int s,
+                      int* ties, int& n);
+    /// Select ties from \a x starting from \a s
+    virtual void ties(Space& home, ViewArray<View>& x, int s,
+                      int* ties, int& n,
+                      BrancherFilter<View>& f);
+    /// Select a view from \a x starting at \a s with unassigned views \a u
+    virtual int select(Space& home, ViewArray<View>& x, int s,
+                       int* u, int& n_u);
+    /// Select ties from \a x starting at \a s with unassigned views \a u
+    virtual void ties(Space& home, ViewArray<View>& x, int s,
+                      int* u, int& n_u, int* ties, int& n);
+    //@}
+  };
+
+  /// Select view with least merit maintained in a heap
+  template<class Merit>
+  class ViewSelMinHeap : public ViewSelChooseHeap<ChooseMin,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMin,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMinHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMinHeap(Space& home, ViewSelMinHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+
+  /// Select view with largest merit maintained in a heap
+  template<class Merit>
+  class ViewSelMaxHeap : public ViewSelChooseHeap<ChooseMax,Merit> {
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::View View;
+    typedef typename ViewSelChooseHeap<ChooseMax,Merit>::Var Var;
+  public:
+    /// \name Initialization
+    //@{
+    /// Constructor for initialization
+    ViewSelMaxHeap(Space& home, const VarBranch<Var>& vb);
+    /// Constructor for copying during cloning
+    ViewSelMaxHeap(Space& home, ViewSelMaxHeap<Merit>& vs);
+    //@}
+    /// \name Resource management and cloning
+    //@{
+    /// Create copy during cloning
+    virtual ViewSel<View>* copy(Space& home);
+    //@}
+  };
+
+
+  /*
+   * The heap
+   *
+   */
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::Heap::Heap(Space& home, Merit& m0,
+                                              ViewArray<View>& x, int s)
+    : LocalObject(home), m(home,m0), n_x(x.size()), n(0),
+      h(home.alloc<int>(x.size()-s)), v(home.alloc<Val>(x.size()-s)),
+      p(home.alloc<int>(x.size())) {
+    for (int i=0; i<s; i++)
+      p[i] = -1;
+    for (int i=s; i<n_x; i++)
+      if (x[i].assigned()) {
+        p[i] = -1;
+      } else {
+        h[n] = i; v[n] = m(home,x[i],i); p[i] = n;
+        up(n++);
+      }
+  }
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::Heap::Heap(Space& home, Heap& hp)
+    : LocalObject(home,hp), m(home,hp.m), n_x(hp.n_x), n(hp.n),
+      h((hp.n > 0) ? home.alloc<int>(hp.n) : NULL),
+      v((hp.n > 0) ? home.alloc<Val>(hp.n) : NULL),
+      p(home.alloc<int>(hp.n_x)) {
+    for (int i=0; i<n; i++) {
+      h[i] = hp.h[i]; v[i] = hp.v[i];
+    }
+    for (int i=0; i<n_x; i++)
+      p[i] = hp.p[i];
+  }
+
+  template<class Choose, class Merit>
+  Actor*
+  ViewSelChooseHeap<Choose,Merit>::Heap::copy(Space& home) {
+    return new (home) Heap(home,*this);
+  }
+
+  template<class Choose, class Merit>
+  forceinline bool
+  ViewSelChooseHeap<Choose,Merit>::Heap::better(int i, int j) const {
+    return c(v[i],v[j]) || (!c(v[j],v[i]) && (h[i] < h[j]));
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelChooseHeap<Choose,Merit>::Heap::swap(int i, int j) {
+    std::swap(h[i],h[j]); std::swap(v[i],v[j]);
+    p[h[i]] = i; p[h[j]] = j;
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelChooseHeap<Choose,Merit>::Heap::up(int i) {
+    while ((i > 0) && better(i,(i-1) >> 1)) {
+      swap(i,(i-1) >> 1); i = (i-1) >> 1;
+    }
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelChooseHeap<Choose,Merit>::Heap::down(int i) {
+    while (true) {
+      int b = i;
+      int l = 2*i+1;
+      if ((l < n) && better(l,b))
+        b = l;
+      if ((l+1 < n) && better(l+1,b))
+        b = l+1;
+      if (b == i)
+        return;
+      swap(i,b); i = b;
+    }
+  }
+
+  template<class Choose, class Merit>
+  forceinline int
+  ViewSelChooseHeap<Choose,Merit>::Heap::top(void) const {
+    assert(n > 0);
+    return h[0];
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelChooseHeap<Choose,Merit>::Heap::update(const Space& home,
+                                                View x, int i) {
+    int k = p[i];
+    assert(k >= 0);
+    Val mx = m(home,x,i);
+    if (c(mx,v[k])) {
+      v[k] = mx; up(k);
+    } else if (c(v[k],mx)) {
+      v[k] = mx; down(k);
+    }
+  }
+
+  template<class Choose, class Merit>
+  forceinline void
+  ViewSelChooseHeap<Choose,Merit>::Heap::remove(int i) {
+    int k = p[i];
+    assert(k >= 0);
+    p[i] = -1;
+    if (k == --n)
+      return;
+    h[k] = h[n]; v[k] = v[n]; p[h[k]] = k;
+    up(k); down(k);
+  }
+
+  template<class Choose, class Merit>
+  void
+  ViewSelChooseHeap<Choose,Merit>::Heap::ties(int* t, int& n_t) const {
+    // Entries with the best merit form a subtree below the root
+    Region r;
+    int* s = r.alloc<int>(n);
+    int n_s = 0;
+    n_t = 0;
+    s[n_s++] = 0;
+    while (n_s > 0) {
+      int k = s[--n_s];
+      t[n_t++] = h[k];
+      for (int l=2*k+1; (l < 2*k+3) && (l < n); l++)
+        if (!c(v[0],v[l]))
+          s[n_s++] = l;
+    }
+    // Ties must be ordered by position
+    Support::quicksort(t,n_t);
+  }
+
+
+  /*
+   * Heap handle
+   *
+   */
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::HeapHandle::HeapHandle(void) {}
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::HeapHandle::HeapHandle(Heap* hp)
+    : LocalHandle(hp) {}
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::HeapHandle::HeapHandle
+  (const HeapHandle& hh)
+    : LocalHandle(hh) {}
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::HeapHandle::operator bool(void) const {
+    return object() != NULL;
+  }
+
+  template<class Choose, class Merit>
+  forceinline typename ViewSelChooseHeap<Choose,Merit>::Heap&
+  ViewSelChooseHeap<Choose,Merit>::HeapHandle::operator *(void) const {
+    return *static_cast<Heap*>(object());
+  }
+
+
+  /*
+   * Recorder propagator
+   *
+   */
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::Recorder::Idx::Idx(Space& home,
+                                                      Propagator& p,
+                                                      Council<Idx>& c,
+                                                      int i)
+    : Advisor(home,p,c), _idx(i) {}
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::Recorder::Idx::Idx(Space& home, Idx& a)
+    : Advisor(home,a), _idx(a._idx) {}
+
+  template<class Choose, class Merit>
+  forceinline int
+  ViewSelChooseHeap<Choose,Merit>::Recorder::Idx::idx(void) const {
+    return _idx;
+  }
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::Recorder::Recorder(Home home,
+                                                      ViewArray<View>& x,
+                                                      HeapHandle& h0)
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), h(h0), c(home) {
+    for (int i=0; i<x.size(); i++)
+      if ((*h).p[i] >= 0)
+        x[i].subscribe(home,*new (home) Idx(home,*this,c,i));
+  }
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::Recorder::Recorder(Space& home,
+                                                      Recorder& p)
+    : NaryPropagator<View,PC_GEN_NONE>(home,p) {
+    h.update(home,p.h);
+    c.update(home,p.c);
+  }
+
+  template<class Choose, class Merit>
+  Propagator*
+  ViewSelChooseHeap<Choose,Merit>::Recorder::copy(Space& home) {
+    return new (home) Recorder(home,*this);
+  }
+
+  template<class Choose, class Merit>
+  PropCost
+  ViewSelChooseHeap<Choose,Merit>::Recorder::cost(const Space&,
+                                                  const ModEventDelta&)
+    const {
+    return PropCost::record();
+  }
+
+  template<class Choose, class Merit>
+  void
+  ViewSelChooseHeap<Choose,Merit>::Recorder::reschedule(Space&) {}
+
+  template<class Choose, class Merit>
+  ExecStatus
+  ViewSelChooseHeap<Choose,Merit>::Recorder::advise(Space& home,
+                                                    Advisor& a,
+                                                    const Delta&) {
+    int i = static_cast<Idx&>(a).idx();
+    if (x[i].assigned()) {
+      (*h).remove(i);
+      a.dispose(home,c);
+    } else {
+      (*h).update(home,x[i],i);
+    }
+    return ES_FIX;
+  }
+
+  template<class Choose, class Merit>
+  ExecStatus
+  ViewSelChooseHeap<Choose,Merit>::Recorder::propagate(Space&,
+                                                       const ModEventDelta&) {
+    // The recorder is never scheduled
+    GECODE_NEVER;
+    return ES_FIX;
+  }
+
+  template<class Choose, class Merit>
+  size_t
+  ViewSelChooseHeap<Choose,Merit>::Recorder::dispose(Space& home) {
+    for (Advisors<Idx> as(c); as(); ++as)
+      x[as.advisor().idx()].cancel(home,as.advisor());
+    c.dispose(home);
+    (void) NaryPropagator<View,PC_GEN_NONE>::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * View selection
+   *
+   */
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::ViewSelChooseHeap(Space& home,
+                                                     const VarBranch<Var>& vb)
+    : ViewSelChoose<Choose,Merit>(home,vb), scan(false) {}
+
+  template<class Choose, class Merit>
+  forceinline
+  ViewSelChooseHeap<Choose,Merit>::ViewSelChooseHeap
+  (Space& home, ViewSelChooseHeap<Choose,Merit>& vs)
+    : ViewSelChoose<Choose,Merit>(home,vs), scan(vs.scan) {
+    if (vs.h)
+      h.update(home,vs.h);
+  }
+
+  template<class Choose, class Merit>
+  typename ViewSelChooseHeap<Choose,Merit>::Heap*
+  ViewSelChooseHeap<Choose,Merit>::heap(Space& home, ViewArray<View>& x,
+                                        int s) {
+    if (h)
+      return &(*h);
+    if (scan)
+      return NULL;
+    if (x.size() - s < Kernel::Config::view_sel_heap_limit) {
+      scan = true;
+      return NULL;
+    }
+    h = HeapHandle(new (home) Heap(home,m,x,s));
+    (void) new (home) Recorder(home,x,h);
+    return &(*h);
+  }
+
+  template<class Choose, class Merit>
+  int
+  ViewSelChooseHeap<Choose,Merit>::select(Space& home, ViewArray<View>& x,
+                                          int s) {
+    if (Heap* hp = heap(home,x,s))
+      return hp->top();
+    return ViewSelChoose<Choose,Merit>::select(home,x,s);
+  }
+
+  template<class Choose, class Merit>
+  int
+  ViewSelChooseHeap<Choose,Merit>::select(Space& home, ViewArray<View>& x,
+                                          int s, BrancherFilter<View>& f) {
+    return ViewSelChoose<Choose,Merit>::select(home,x,s,f);
+  }
+
+  template<class Choose, class Merit>
+  void
+  ViewSelChooseHeap<Choose,Merit>::ties(Space& home, ViewArray<View>& x,
+                                        int s, int* ties, int& n) {
+    if (Heap* hp = heap(home,x,s))
+      hp->ties(ties,n);
+    else
+      ViewSelChoose<Choose,Merit>::ties(home,x,s,ties,n);
+  }
+
+  template<class Choose, class Merit>
+  void
+  ViewSelChooseHeap<Choose,Merit>::ties(Space& home, ViewArray<View>& x,
+                                        int s, int* ties, int& n,
+                                        BrancherFilter<View>& f) {
+    ViewSelChoose<Choose,Merit>::ties(home,x,s,ties,n,f);
+  }
+
+  template<class Choose, class Merit>
+  int
+  ViewSelChooseHeap<Choose,Merit>::select(Space& home, ViewArray<View>& x,
+                                          int s, int* u, int& n_u) {
+    if (Heap* hp = heap(home,x,s))
+      return hp->top();
+    return ViewSel<View>::select(home,x,s,u,n_u);
+  }
+
+  template<class Choose, class Merit>
+  void
+  ViewSelChooseHeap<Choose,Merit>::ties(Space& home, ViewArray<View>& x,
+                                        int s, int* u, int& n_u,
+                                        int* ties, int& n) {
+    if (Heap* hp = heap(home,x,s))
+      hp->ties(ties,n);
+    else
+      ViewSel<View>::ties(home,x,s,u,n_u,ties,n);
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home, const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vb) {}
+
+  template<class Merit>
+  forceinline
+  ViewSelMinHeap<Merit>::ViewSelMinHeap(Space& home, ViewSelMinHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMin,Merit>(home,vs) {}
+
+  template<class Merit>
+  ViewSel<typename ViewSelMinHeap<Merit>::View>*
+  ViewSelMinHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMinHeap<Merit>(home,*this);
+  }
+
+
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home, const VarBranch<Var>& vb)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vb) {}
+
+  template<class Merit>
+  forceinline
+  ViewSelMaxHeap<Merit>::ViewSelMaxHeap(Space& home, ViewSelMaxHeap<Merit>& vs)
+    : ViewSelChooseHeap<ChooseMax,Merit>(home,vs) {}
+
+  template<class Merit>
+  ViewSel<typename ViewSelMaxHeap<Merit>::View>*
+  ViewSelMaxHeap<Merit>::copy(Space& home) {
+    return new (home) ViewSelMaxHeap<Merit>(home,*this);
+  }
+
+}
+
+// STATISTICS: kernel-branch
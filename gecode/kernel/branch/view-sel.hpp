@@ -81,6 +81,24 @@ namespace Gecode {
     /// Select a view from \a x considering views with positions in \a ties
     virtual int select(Space& home, ViewArray<View>& x,
                        int* ties, int n) = 0;
+    /**
+     * \brief Select a view from \a x starting from \a s and return its position
+     *
+     * The positions \a u of the \a n_u views that might be unassigned
+     * are in increasing order and start with \a s. Positions of
+     * assigned views can be removed from \a u (keeping the order).
+     */
+    virtual int select(Space& home, ViewArray<View>& x, int s,
+                       int* u, int& n_u);
+    /**
+     * \brief Select ties from \a x starting from \a s
+     *
+     * The positions \a u of the \a n_u views that might be unassigned
+     * are in increasing order and start with \a s. Positions of
+     * assigned views can be removed from \a u (keeping the order).
+     */
+    virtual void ties(Space& home, ViewArray<View>& x, int s,
+                      int* u, int& n_u, int* ties, int& n);
     //@}
     /// \name Resource management and cloning
     //@{
@@ -136,6 +154,9 @@ namespace Gecode {
                      int* ties, int& n);
     /// Select a view from \a x considering view with positions in \a ties
     virtual int select(Space& home, ViewArray<View>& x, int* ties, int n);
+    /// Select a view from \a x starting at \a s with unassigned views \a u
+    virtual int select(Space& home, ViewArray<View>& x, int s,
+                       int* u, int& n_u);
     //@}
     /// \name Resource management and cloning
     //@{
@@ -393,6 +414,35 @@ namespace Gecode {
     GECODE_NEVER;
   }
   template<class View>
+  int
+  ViewSel<View>::select(Space& home, ViewArray<View>& x, int s,
+                        int* u, int& n_u) {
+    assert(u[0] == s);
+    // Remove assigned views while keeping the order
+    int j=0;
+    for (int i=0; i<n_u; i++)
+      if (!x[u[i]].assigned())
+        u[j++]=u[i];
+    n_u=j;
+    assert((n_u > 0) && (u[0] == s));
+    return select(home,x,u,n_u);
+  }
+  template<class View>
+  void
+  ViewSel<View>::ties(Space& home, ViewArray<View>& x, int s,
+                      int* u, int& n_u, int* ties, int& n) {
+    assert(u[0] == s);
+    // Remove assigned views while keeping the order, all are ties
+    int j=0;
+    for (int i=0; i<n_u; i++)
+      if (!x[u[i]].assigned()) {
+        ties[j] = u[j] = u[i]; j++;
+      }
+    n_u=n=j;
+    assert((n_u > 0) && (u[0] == s));
+    brk(home,x,ties,n);
+  }
+  template<class View>
   bool
   ViewSel<View>::notice(void) const {
     return false;
@@ -469,6 +519,11 @@ namespace Gecode {
     return ties[0];
   }
   template<class View>
+  int
+  ViewSelNone<View>::select(Space&, ViewArray<View>&, int s, int*, int&) {
+    return s;
+  }
+  template<class View>
   ViewSel<View>*
   ViewSelNone<View>::copy(Space& home) {
     return new (home) ViewSelNone<View>(home,*this);
@@ -73,6 +73,14 @@ namespace Gecode {
    *
    * Defined for views of type \a View and \a n view selectors for
    * tie-breaking.
+   *
+   * For arrays with at least Kernel::Config::view_compact_limit views
+   * the brancher also maintains the positions of the views that might
+   * still be unassigned. Positions of assigned views are removed when
+   * checking the status and when selecting a view, so that selection
+   * does not scan views that have been assigned earlier and cloning
+   * only copies the remaining positions. The positions are kept in
+   * increasing order, hence the views selected are the same.
    */
   template<class View, class Filter, int n>
   class ViewBrancher : public Brancher {
@@ -83,6 +91,10 @@ namespace Gecode {
     ViewArray<View> x;
     /// Unassigned views start at x[start]
     mutable int start;
+    /// Positions of views that might be unassigned (NULL if not compact)
+    mutable int* u;
+    /// Number of positions in \a u
+    mutable int n_u;
     /// View selection objects
     ViewSel<View>* vs[n];
     /// Filter function
@@ -137,7 +149,13 @@ namespace Gecode {
   ViewBrancher<View,Filter,n>::ViewBrancher(Home home, ViewArray<View>& x0,
                                             ViewSel<View>* vs0[n],
                                             BranchFilter<Var> bf)
-    : Brancher(home), x(x0), start(0), f(bf) {
+    : Brancher(home), x(x0), start(0), u(NULL), n_u(0), f(bf) {
+    if (x.size() >= Kernel::Config::view_compact_limit) {
+      n_u = x.size();
+      u = static_cast<Space&>(home).alloc<int>(n_u);
+      for (int i=0; i<n_u; i++)
+        u[i]=i;
+    }
     for (int i=0; i<n; i++)
       vs[i] = vs0[i];
     for (int i=0; i<n; i++)
@@ -151,8 +169,14 @@ namespace Gecode {
   forceinline
   ViewBrancher<View,Filter,n>::ViewBrancher(Space& home,
                                             ViewBrancher<View,Filter,n>& vb)
-    : Brancher(home,vb), start(vb.start), f(vb.f) {
+    : Brancher(home,vb), start(vb.start), u(NULL), n_u(vb.n_u), f(vb.f) {
     x.update(home,vb.x);
+    if (vb.u != NULL) {
+      // The brancher might be copied after all views have been assigned
+      u = home.alloc<int>(std::max(n_u,1));
+      for (int i=0; i<n_u; i++)
+        u[i]=vb.u[i];
+    }
     for (int i=0; i<n; i++)
       vs[i] = vb.vs[i]->copy(home);
   }
@@ -160,6 +184,17 @@ namespace Gecode {
   template<class View, class Filter, int n>
   bool
   ViewBrancher<View,Filter,n>::status(const Space& home) const {
+    if (u != NULL) {
+      // Skip leading positions just as start is advanced
+      while ((n_u > 0) &&
+             (x[u[0]].assigned() || !f(home,x[u[0]],u[0]))) {
+        u++; n_u--;
+      }
+      if (n_u == 0)
+        return false;
+      start = u[0];
+      return true;
+    }
     for (int i=start; i < x.size(); i++)
       if (!x[i].assigned() && f(home,x[i],i)) {
         start = i;
@@ -173,7 +208,42 @@ namespace Gecode {
   ViewBrancher<View,Filter,n>::pos(Space& home) {
     assert(!x[start].assigned());
     int s;
-    if (f) {
+    if (u != NULL) {
+      assert(u[0] == start);
+      if (f) {
+        // Remove assigned views and select among views passing the filter
+        Region r;
+        int* ties = r.alloc<int>(n_u);
+        int n_ties = 0;
+        int j=0;
+        for (int i=0; i<n_u; i++)
+          if (!x[u[i]].assigned()) {
+            u[j++]=u[i];
+            if (f(home,x[u[i]],u[i]))
+              ties[n_ties++]=u[i];
+          }
+        n_u=j;
+        for (int i=0; (i < n-1) && (n_ties > 1); i++)
+          vs[i]->brk(home,x,ties,n_ties);
+        if (n_ties > 1)
+          s = vs[n-1]->select(home,x,ties,n_ties);
+        else
+          s = ties[0];
+      } else if (n == 1) {
+        s = vs[0]->select(home,x,start,u,n_u);
+      } else {
+        Region r;
+        int* ties = r.alloc<int>(n_u);
+        int n_ties;
+        vs[0]->ties(home,x,start,u,n_u,ties,n_ties);
+        for (int i=1; (i < n-1) && (n_ties > 1); i++)
+          vs[i]->brk(home,x,ties,n_ties);
+        if (n_ties > 1)
+          s = vs[n-1]->select(home,x,ties,n_ties);
+        else
+          s = ties[0];
+      }
+    } else if (f) {
       if (n == 1) {
         s = vs[0]->select(home,x,start,f);
       } else {
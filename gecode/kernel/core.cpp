@@ -383,7 +383,7 @@ namespace Gecode {
         }
       d_stable: ;
       } else {
-        // Support disabled propagators and tracing
+        // Support disabled propagators, tracing, and profiling
 
 #define GECODE_STATUS_TRACE(q,s) \
   if ((tr != NULL) && (tr->events() & TE_PROPAGATE) && \
@@ -395,8 +395,16 @@ namespace Gecode {
 
         // Find a non-disabled tracer recorder (possibly null)
         TraceRecorder* tr = findtracerecorder();
+        // Profile to record to (possibly null)
+        PropagatorProfile* pp =
+          ((pc.p.bid_sc & sc_profile) && (&stat != &unused_status)) ?
+          &stat.profile : NULL;
+        // Sample buffer to record to (possibly null)
+        Sampler::Buffer* sb = (pc.p.bid_sc & sc_sample) ?
+          ssd.data().sampler->buffer() : NULL;
         // Remember post information
         ViewTraceInfo vti(pc.p.vti);
+        ExecStatus es;
         goto t_unstable;
 
       t_execute:
@@ -408,7 +416,28 @@ namespace Gecode {
         med_o = p->u.med;
         // Clear med but leave propagator in queue
         p->u.med = 0;
-        switch (p->propagate(*this,med_o)) {
+        if (sb != NULL)
+          sb->propagate(*p);
+        if (pp == NULL) {
+          es = p->propagate(*this,med_o);
+        } else {
+          // Remember the last propagator of each queue: if a queue
+          // changes, the propagator has modified a variable
+          ActorLink* l[PropCost::AC_MAX+1];
+          for (int i=0; i<=PropCost::AC_MAX; i++)
+            l[i] = pc.p.queue[i].prev();
+          unsigned long long int t = Support::ticks();
+          es = p->propagate(*this,med_o);
+          t = Support::ticks() - t;
+          // For a subsumed propagator, med has been overwritten by its size
+          bool m = (es != __ES_SUBSUMED) && (p->u.med != 0);
+          for (int i=0; !m && (i<=PropCost::AC_MAX); i++)
+            m = (l[i] != pc.p.queue[i].prev());
+          pp->record(*p,es,t,m);
+        }
+        if (sb != NULL)
+          sb->idle();
+        switch (es) {
         case ES_FAILED:
           GECODE_STATUS_TRACE(p,FAILED);
           goto failed;
@@ -586,6 +615,10 @@ namespace Gecode {
       return;
     if (Brancher* b = brancher(c.bid)) {
       // There is a matching brancher
+      Sampler::Buffer* sb = (pc.p.bid_sc & sc_sample) ?
+        ssd.data().sampler->buffer() : NULL;
+      if (sb != NULL)
+        sb->commit(*b);
       if (pc.p.bid_sc & sc_trace) {
         TraceRecorder* tr = findtracerecorder();
         if ((tr != NULL) && (tr->events() & TE_COMMIT) &&
@@ -603,6 +636,8 @@ namespace Gecode {
         if (b->commit(*this,c,a) == ES_FAILED)
           fail();
       }
+      if (sb != NULL)
+        sb->idle();
     } else {
       // There is no matching brancher!
       throw SpaceNoBrancher("Space::commit");
@@ -617,6 +652,10 @@ namespace Gecode {
       return;
     if (Brancher* b = brancher(c.bid)) {
       // There is a matching brancher
+      Sampler::Buffer* sb = (pc.p.bid_sc & sc_sample) ?
+        ssd.data().sampler->buffer() : NULL;
+      if (sb != NULL)
+        sb->commit(*b);
       if (pc.p.bid_sc & sc_trace) {
         TraceRecorder* tr = findtracerecorder();
         if ((tr != NULL) && (tr->events() & TE_COMMIT) &&
@@ -634,6 +673,8 @@ namespace Gecode {
         if (b->commit(*this,c,a) == ES_FAILED)
           fail();
       }
+      if (sb != NULL)
+        sb->idle();
     }
   }
 
@@ -746,6 +787,15 @@ namespace Gecode {
     }
   }
 
+  Space*
+  Space::_clone(CloneStatistics& stat) {
+    unsigned long long int t = Support::ticks();
+    Space* c = _clone();
+    stat.ticks += Support::ticks() - t;
+    stat.bytes += c->mm.allocated();
+    return c;
+  }
+
   Space*
   Space::_clone(void) {
     if (failed())
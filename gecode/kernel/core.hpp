@@ -1484,6 +1484,11 @@ namespace Gecode {
      *
      * The current brancher in the space \a home performs a commit from
      * the information provided by the choice \a c and the alternative \a a.
+     *
+     * A commit must not rely on propagation after earlier commits: when
+     * search recomputes a space, all choices on the path are committed
+     * one after the other and the space is propagated only once
+     * afterwards.
      */
     virtual ExecStatus commit(Space& home, const Choice& c,
                               unsigned int a) = 0;
@@ -1684,6 +1689,81 @@ namespace Gecode {
     SS_BRANCH  ///< %Space must be branched (at least one brancher left)
   };
 
+  /**
+   * \brief Profile information for propagator classes
+   *
+   * For each class of propagators (identified by its dynamic type)
+   * the profile records the number of executions, their outcome,
+   * how many executions modified variables, and the time spent
+   * in ticks (see Support::ticks). Profile information is only
+   * recorded for spaces that have profiling switched on (see
+   * Space::profile).
+   *
+   */
+  class GECODE_KERNEL_EXPORT PropagatorProfile {
+  public:
+    /// Profile information for a single propagator class
+    class Entry {
+    public:
+      /// Implementation-specific name of the class (used as key)
+      const char* key;
+      /// Readable name of the class
+      char* name;
+      /// Number of executions
+      unsigned long int propagate;
+      /// Number of executions that computed a fixpoint
+      unsigned long int fix;
+      /// Number of executions that did not compute a fixpoint
+      unsigned long int nofix;
+      /// Number of executions that resulted in subsumption
+      unsigned long int subsumed;
+      /// Number of executions that resulted in failure
+      unsigned long int failed;
+      /// Number of executions that modified variables
+      unsigned long int prune;
+      /// Number of ticks spent in executions
+      unsigned long long int ticks;
+    };
+  protected:
+    /// Number of entries
+    int n;
+    /// Number of entries for which memory is allocated
+    int lim;
+    /// The entries
+    Entry* e;
+    /// Return entry for key \a k, create it if needed
+    Entry& entry(const char* k);
+    /// Add entries from profile \a p
+    void add(const PropagatorProfile& p);
+    /// Release all memory
+    void dispose(void);
+  public:
+    /// Initialize with no entries
+    PropagatorProfile(void);
+    /// Copy constructor
+    PropagatorProfile(const PropagatorProfile& p);
+    /// Assignment operator
+    PropagatorProfile& operator =(const PropagatorProfile& p);
+    /// Destructor
+    ~PropagatorProfile(void);
+    /// Reset information
+    void reset(void);
+    /// Return number of entries
+    int entries(void) const;
+    /// Return entry \a i
+    const Entry& operator [](int i) const;
+    /**
+     * \brief Record execution of propagator \a p
+     *
+     * The execution returned \a es, took \a t ticks, and \a m
+     * is whether variables have been modified.
+     */
+    void record(const Propagator& p, ExecStatus es,
+                unsigned long long int t, bool m);
+    /// Increment by profile \a p
+    PropagatorProfile& operator +=(const PropagatorProfile& p);
+  };
+
   /**
    * \brief %Statistics for execution of status
    *
@@ -1692,6 +1772,8 @@ namespace Gecode {
   public:
     /// Number of propagator executions
     unsigned long int propagate;
+    /// Profile information for propagators (only if profiling)
+    PropagatorProfile profile;
     /// Initialize
     StatusStatistics(void);
     /// Reset information
@@ -1708,6 +1790,12 @@ namespace Gecode {
    */
   class CloneStatistics {
   public:
+    /// Number of clone operations
+    unsigned long int clone;
+    /// Memory allocated by clones in bytes (only if profiling)
+    unsigned long long int bytes;
+    /// Number of ticks spent cloning (only if profiling)
+    unsigned long long int ticks;
     /// Initialize
     CloneStatistics(void);
     /// Reset information
@@ -1724,6 +1812,8 @@ namespace Gecode {
    */
   class CommitStatistics {
   public:
+    /// Number of commit operations
+    unsigned long int commit;
     /// Initialize
     CommitStatistics(void);
     /// Reset information
@@ -1804,13 +1894,17 @@ namespace Gecode {
     static const unsigned reserved_bid = 0U;
 
     /// Number of bits for status control
-    static const unsigned int sc_bits = 2;
+    static const unsigned int sc_bits = 4;
     /// No special features activated
     static const unsigned int sc_fast = 0;
     /// Disabled propagators are supported
     static const unsigned int sc_disabled = 1;
     /// Tracing is supported
     static const unsigned int sc_trace = 2;
+    /// Profiling is supported
+    static const unsigned int sc_profile = 4;
+    /// Sampling is supported
+    static const unsigned int sc_sample = 8;
 
     union {
       /// Data only available during propagation or branching
@@ -1833,7 +1927,7 @@ namespace Gecode {
         /**
          * \brief Id of next brancher to be created plus status control
          *
-         * The last two bits are reserved for status control.
+         * The last four bits are reserved for status control.
          *
          */
         unsigned int bid_sc;
@@ -1900,6 +1994,8 @@ namespace Gecode {
      *
      */
     GECODE_KERNEL_EXPORT Space* _clone(void);
+    /// Clone space and record profile information in \a stat
+    GECODE_KERNEL_EXPORT Space* _clone(CloneStatistics& stat);
 
     /**
      * \brief Commit choice \a c for alternative \a a
@@ -2105,6 +2201,30 @@ namespace Gecode {
     GECODE_KERNEL_EXPORT
     SpaceStatus status(StatusStatistics& stat=unused_status);
 
+    /**
+     * \brief Switch profiling on or off according to \a b
+     *
+     * If profiling is switched on, status records profile information
+     * for propagators and clone records the time spent and memory
+     * allocated. Clones inherit whether profiling is switched on.
+     * Profile information is not recorded for the default statistics
+     * arguments.
+     *
+     * \ingroup TaskSearch
+     */
+    void profile(bool b);
+    /// Test whether profiling is switched on
+    bool profile(void) const;
+    /**
+     * \brief Record samples of propagator and brancher executions in \a s
+     *
+     * Clones of the space also record samples in \a s, hence the
+     * sampler must outlive the space and all its clones.
+     *
+     * \ingroup TaskTrace
+     */
+    void sample(Sampler& s);
+
     /**
      * \brief Create new choice for current brancher
      *
@@ -2651,6 +2771,20 @@ namespace Gecode {
     void afc_decay(double d);
     /// Return AFC decay factor
     double afc_decay(void) const;
+    /**
+     * \brief %Set AFC merge interval to \a k
+     *
+     * Each thread counts up to \a k failures without synchronization
+     * before it merges them into the AFC values shared by all threads.
+     * The failures are also merged when a parallel search engine steals
+     * work, restarts, or terminates. Until then, the merged AFC values
+     * do not reflect the pending failures. The default interval is one,
+     * that is, every failure is merged immediately. The interval is
+     * limited by Kernel::Config::afc_merge_max.
+     */
+    void afc_merge(unsigned int k);
+    /// Return AFC merge interval
+    unsigned int afc_merge(void) const;
     /// Unshare AFC information for all propagators
     GECODE_KERNEL_EXPORT void afc_unshare(void);
     //@}
@@ -3221,23 +3355,47 @@ namespace Gecode {
   }
 
   forceinline Space*
-  Space::clone(CloneStatistics&) const {
+  Space::clone(CloneStatistics& stat) const {
+    stat.clone++;
     // Clone is only const for search engines. During cloning, several data
     // structures are updated (e.g. forwarding pointers), so we have to
     // cast away the constness.
+    if ((pc.p.bid_sc & sc_profile) && (&stat != &unused_clone))
+      return const_cast<Space*>(this)->_clone(stat);
     return const_cast<Space*>(this)->_clone();
   }
 
   forceinline void
-  Space::commit(const Choice& c, unsigned int a, CommitStatistics&) {
+  Space::commit(const Choice& c, unsigned int a, CommitStatistics& stat) {
+    stat.commit++;
     _commit(c,a);
   }
 
   forceinline void
-  Space::trycommit(const Choice& c, unsigned int a, CommitStatistics&) {
+  Space::trycommit(const Choice& c, unsigned int a, CommitStatistics& stat) {
+    stat.commit++;
     _trycommit(c,a);
   }
 
+  forceinline void
+  Space::profile(bool b) {
+    if (b)
+      pc.p.bid_sc |= sc_profile;
+    else
+      pc.p.bid_sc &= ~sc_profile;
+  }
+
+  forceinline bool
+  Space::profile(void) const {
+    return (pc.p.bid_sc & sc_profile) != 0U;
+  }
+
+  forceinline void
+  Space::sample(Sampler& s) {
+    ssd.data().sampler = &s;
+    pc.p.bid_sc |= sc_sample;
+  }
+
   forceinline double
   Space::afc_decay(void) const {
     return ssd.data().gpi.decay();
@@ -3248,6 +3406,16 @@ namespace Gecode {
     ssd.data().gpi.decay(d);
   }
 
+  forceinline unsigned int
+  Space::afc_merge(void) const {
+    return ssd.data().gpi.merge();
+  }
+
+  forceinline void
+  Space::afc_merge(unsigned int k) {
+    ssd.data().gpi.merge(k);
+  }
+
   forceinline size_t
   Actor::dispose(Space&) {
     return sizeof(*this);
@@ -4686,9 +4854,54 @@ namespace Gecode {
    * Statistics
    */
 
+  forceinline
+  PropagatorProfile::PropagatorProfile(void)
+    : n(0), lim(0), e(NULL) {}
+  forceinline
+  PropagatorProfile::PropagatorProfile(const PropagatorProfile& p)
+    : n(0), lim(0), e(NULL) {
+    if (p.n > 0)
+      add(p);
+  }
+  forceinline PropagatorProfile&
+  PropagatorProfile::operator =(const PropagatorProfile& p) {
+    if (this != &p) {
+      reset();
+      if (p.n > 0)
+        add(p);
+    }
+    return *this;
+  }
+  forceinline
+  PropagatorProfile::~PropagatorProfile(void) {
+    if (e != NULL)
+      dispose();
+  }
+  forceinline void
+  PropagatorProfile::reset(void) {
+    if (e != NULL)
+      dispose();
+  }
+  forceinline int
+  PropagatorProfile::entries(void) const {
+    return n;
+  }
+  forceinline const PropagatorProfile::Entry&
+  PropagatorProfile::operator [](int i) const {
+    assert((i >= 0) && (i < n));
+    return e[i];
+  }
+  forceinline PropagatorProfile&
+  PropagatorProfile::operator +=(const PropagatorProfile& p) {
+    if (p.n > 0)
+      add(p);
+    return *this;
+  }
+
   forceinline void
   StatusStatistics::reset(void) {
     propagate = 0;
+    profile.reset();
   }
   forceinline
   StatusStatistics::StatusStatistics(void) {
@@ -4697,6 +4910,7 @@ namespace Gecode {
   forceinline StatusStatistics&
   StatusStatistics::operator +=(const StatusStatistics& s) {
     propagate += s.propagate;
+    profile += s.profile;
     return *this;
   }
   forceinline StatusStatistics
@@ -4706,36 +4920,42 @@ namespace Gecode {
   }
 
   forceinline void
-  CloneStatistics::reset(void) {}
+  CloneStatistics::reset(void) {
+    clone=0; bytes=0; ticks=0;
+  }
 
   forceinline
   CloneStatistics::CloneStatistics(void) {
     reset();
   }
   forceinline CloneStatistics
-  CloneStatistics::operator +(const CloneStatistics&) {
-    CloneStatistics s;
-    return s;
+  CloneStatistics::operator +(const CloneStatistics& s) {
+    CloneStatistics t(s);
+    return t += *this;
   }
   forceinline CloneStatistics&
-  CloneStatistics::operator +=(const CloneStatistics&) {
+  CloneStatistics::operator +=(const CloneStatistics& s) {
+    clone += s.clone; bytes += s.bytes; ticks += s.ticks;
     return *this;
   }
 
   forceinline void
-  CommitStatistics::reset(void) {}
+  CommitStatistics::reset(void) {
+    commit=0;
+  }
 
   forceinline
   CommitStatistics::CommitStatistics(void) {
     reset();
   }
   forceinline CommitStatistics
-  CommitStatistics::operator +(const CommitStatistics&) {
-    CommitStatistics s;
-    return s;
+  CommitStatistics::operator +(const CommitStatistics& s) {
+    CommitStatistics t(s);
+    return t += *this;
   }
   forceinline CommitStatistics&
-  CommitStatistics::operator +=(const CommitStatistics&) {
+  CommitStatistics::operator +=(const CommitStatistics& s) {
+    commit += s.commit;
     return *this;
   }
 
@@ -68,15 +68,24 @@ namespace Gecode {
   UninitializedAction::UninitializedAction(const char* l)
     : Exception(l,"Uninitialized action information for branching") {}
 
+  UninitializedPhase::UninitializedPhase(const char* l)
+    : Exception(l,"Uninitialized phase information for branching") {}
+
   UninitializedCHB::UninitializedCHB(const char* l)
     : Exception(l,"Uninitialized CHB information for branching") {}
 
+  UninitializedConflict::UninitializedConflict(const char* l)
+    : Exception(l,"Uninitialized conflict information for branching") {}
+
   UninitializedRnd::UninitializedRnd(const char* l)
     : Exception(l,"Uninitialized random generator for branching") {}
 
   IllegalDecay::IllegalDecay(const char* l)
     : Exception(l,"Illegal decay factor") {}
 
+  IllegalConflict::IllegalConflict(const char* l)
+    : Exception(l,"Illegal number of conflict variables") {}
+
   InvalidFunction::InvalidFunction(const char* l)
     : Exception(l,"Invalid function") {}
 
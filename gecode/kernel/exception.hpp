@@ -110,6 +110,13 @@ namespace Gecode {
     IllegalDecay(const char* l);
   };
 
+  /// %Exception: illegal number of conflict variables
+  class GECODE_KERNEL_EXPORT IllegalConflict : public Exception {
+  public:
+    /// Initialize with location \a l
+    IllegalConflict(const char* l);
+  };
+
   /// %Exception: invalid function
   class GECODE_KERNEL_EXPORT InvalidFunction : public Exception {
   public:
@@ -131,6 +138,13 @@ namespace Gecode {
     UninitializedAction(const char* l);
   };
 
+  /// %Exception: uninitialized phase
+  class GECODE_KERNEL_EXPORT UninitializedPhase : public Exception {
+  public:
+    /// Initialize with location \a l
+    UninitializedPhase(const char* l);
+  };
+
   /// %Exception: uninitialized CHB
   class GECODE_KERNEL_EXPORT UninitializedCHB : public Exception {
   public:
@@ -138,6 +152,13 @@ namespace Gecode {
     UninitializedCHB(const char* l);
   };
 
+  /// %Exception: uninitialized conflict information
+  class GECODE_KERNEL_EXPORT UninitializedConflict : public Exception {
+  public:
+    /// Initialize with location \a l
+    UninitializedConflict(const char* l);
+  };
+
   /// %Exception: uninitialized random number generator
   class GECODE_KERNEL_EXPORT UninitializedRnd : public Exception {
   public:
@@ -37,6 +37,118 @@ namespace Gecode { namespace Kernel {
 
   Support::Mutex GPI::m;
 
+  /*
+   * Deferred failures
+   *
+   * Every thread owns a buffer of failures that have not yet been
+   * merged into the afc values. All buffers are registered so that
+   * deleting a GPI can discard failures still referring to it.
+   *
+   */
+  class GPI::Buffer {
+  public:
+    /// Mutex for synchronizing with discarding failures
+    Support::Mutex m;
+    /// The GPI the failures belong to
+    GPI* gpi;
+    /// Number of deferred failures
+    unsigned int n;
+    /// Information for deferred failures
+    Info* info[Kernel::Config::afc_merge_max];
+    /// Previous and next buffer in registry
+    Buffer* prev; Buffer* next;
+    /// Mutex for registry
+    static Support::Mutex rm;
+    /// All registered buffers
+    static Buffer* all;
+    /// Initialize and register
+    Buffer(void);
+    /// Merge failures into afc values
+    void merge(void);
+    /// Merge remaining failures and unregister
+    ~Buffer(void);
+    /// Return buffer of the calling thread
+    static Buffer& current(void);
+  };
+
+  Support::Mutex GPI::Buffer::rm;
+  GPI::Buffer* GPI::Buffer::all = NULL;
+
+  GPI::Buffer::Buffer(void) : gpi(NULL), n(0U), prev(NULL) {
+    rm.acquire();
+    next = all;
+    if (all != NULL)
+      all->prev = this;
+    all = this;
+    rm.release();
+  }
+
+  forceinline void
+  GPI::Buffer::merge(void) {
+    if (n > 0U) {
+      GPI::m.acquire();
+      for (unsigned int i=0U; i<n; i++)
+        gpi->inc(*info[i]);
+      GPI::m.release();
+      n = 0U;
+    }
+  }
+
+  GPI::Buffer::~Buffer(void) {
+    m.acquire();
+    merge();
+    m.release();
+    rm.acquire();
+    if (prev != NULL)
+      prev->next = next;
+    else
+      all = next;
+    if (next != NULL)
+      next->prev = prev;
+    rm.release();
+  }
+
+  forceinline GPI::Buffer&
+  GPI::Buffer::current(void) {
+    static thread_local Buffer b;
+    return b;
+  }
+
+  void
+  GPI::defer(Info& c) {
+    Buffer& b = Buffer::current();
+    b.m.acquire();
+    if (b.gpi != this) {
+      b.merge();
+      b.gpi = this;
+    }
+    b.info[b.n++] = &c;
+    if (b.n >= mi)
+      b.merge();
+    b.m.release();
+  }
+
+  void
+  GPI::flush(void) {
+    Buffer& b = Buffer::current();
+    b.m.acquire();
+    b.merge();
+    b.m.release();
+  }
+
+  void
+  GPI::discard(void) {
+    Buffer::rm.acquire();
+    for (Buffer* b = Buffer::all; b != NULL; b = b->next) {
+      b->m.acquire();
+      if (b->gpi == this) {
+        b->gpi = NULL; b->n = 0U;
+      }
+      b->m.release();
+    }
+    Buffer::rm.release();
+  }
+
 }}
 
 // STATISTICS: kernel-prop
@@ -67,10 +67,14 @@ namespace Gecode { namespace Kernel {
       /// Rescale used afc values in entries
       void rescale(void);
     };
+    /// Buffer of failures deferred by a thread
+    class Buffer;
     /// The current block
     Block* b;
     /// The inverse decay factor
     double invd;
+    /// After how many failures deferred failures are merged
+    unsigned int mi;
     /// Next free propagator id
     unsigned int npid;
     /// Whether to unshare
@@ -79,6 +83,12 @@ namespace Gecode { namespace Kernel {
     Block fst;
     /// Mutex to synchronize globally shared access
     GECODE_KERNEL_EXPORT static Support::Mutex m;
+    /// Increment failure count (mutex must be held)
+    void inc(Info& c);
+    /// Defer incrementing failure count to the buffer of the calling thread
+    GECODE_KERNEL_EXPORT void defer(Info& c);
+    /// Discard deferred failures of all threads
+    GECODE_KERNEL_EXPORT void discard(void);
   public:
     /// Initialize
     GPI(void);
@@ -86,6 +96,12 @@ namespace Gecode { namespace Kernel {
     void decay(double d);
     /// Return decay factor
     double decay(void) const;
+    /// Set merge interval to \a k
+    void merge(unsigned int k);
+    /// Return merge interval
+    unsigned int merge(void) const;
+    /// Merge failures deferred by the calling thread
+    GECODE_KERNEL_EXPORT static void flush(void);
     /// Increment failure count
     void fail(Info& c);
     /// Allocate info for existing propagator with pid \a p
@@ -120,15 +136,40 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   GPI::GPI(void)
-    : b(&fst), invd(1.0), npid(0U), us(false) {}
+    : b(&fst), invd(1.0), mi(1U), npid(0U), us(false) {}
 
   forceinline void
-  GPI::fail(Info& c) {
-    m.acquire();
+  GPI::inc(Info& c) {
     c.afc = invd * (c.afc + 1.0);
     if (c.afc > Kernel::Config::rescale_limit)
       for (Block* i = b; i != NULL; i = i->next)
         i->rescale();
+  }
+
+  forceinline void
+  GPI::fail(Info& c) {
+    if (mi > 1U) {
+      defer(c);
+    } else {
+      m.acquire();
+      inc(c);
+      m.release();
+    }
+  }
+
+  forceinline unsigned int
+  GPI::merge(void) const {
+    return mi;
+  }
+
+  forceinline void
+  GPI::merge(unsigned int k) {
+    if (k < 1U)
+      k = 1U;
+    if (k > Kernel::Config::afc_merge_max)
+      k = Kernel::Config::afc_merge_max;
+    m.acquire();
+    mi = k;
     m.release();
   }
 
@@ -196,6 +237,7 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   GPI::~GPI(void) {
+    discard();
     Block* n = b;
     while (n != &fst) {
       Block* d = n;
@@ -145,6 +145,8 @@ namespace Gecode { namespace Kernel {
     void* alloc(SharedMemory& sm, size_t s);
     /// Get the memory area for subscriptions
     void* subscriptions(void) const;
+    /// Return the amount of heap memory in use (approximately)
+    size_t allocated(void) const;
 
   private:
     /// Start of free lists
@@ -298,6 +300,11 @@ namespace Gecode { namespace Kernel {
     return &cur_hc->area[0];
   }
 
+  forceinline size_t
+  MemoryManager::allocated(void) const {
+    return requested - lsz;
+  }
+
   forceinline void
   MemoryManager::alloc_fill(SharedMemory& sm, size_t sz, bool first) {
     // Adjust current heap chunk size
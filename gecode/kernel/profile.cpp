@@ -0,0 +1,118 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+#include <typeinfo>
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#endif
+
+namespace Gecode {
+
+  PropagatorProfile::Entry&
+  PropagatorProfile::entry(const char* k) {
+    // Type names of the same class are typically identical pointers
+    for (int i=0; i<n; i++)
+      if (e[i].key == k)
+        return e[i];
+    for (int i=0; i<n; i++)
+      if (strcmp(e[i].key,k) == 0)
+        return e[i];
+    if (n == lim) {
+      int l = (lim == 0) ? 8 : 2*lim;
+      e = heap.realloc<Entry>(e,lim,l);
+      lim = l;
+    }
+    Entry& x = e[n++];
+    x.key = k;
+    const char* s = k;
+#ifdef __GNUC__
+    int status;
+    char* d = abi::__cxa_demangle(k,NULL,NULL,&status);
+    if (status == 0)
+      s = d;
+#endif
+    size_t l = strlen(s);
+    x.name = heap.alloc<char>(l+1);
+    memcpy(x.name,s,l+1);
+#ifdef __GNUC__
+    free(d);
+#endif
+    x.propagate = x.fix = x.nofix = x.subsumed = x.failed = x.prune = 0;
+    x.ticks = 0;
+    return x;
+  }
+
+  void
+  PropagatorProfile::add(const PropagatorProfile& p) {
+    for (int i=0; i<p.n; i++) {
+      Entry& x = entry(p.e[i].key);
+      x.propagate += p.e[i].propagate;
+      x.fix += p.e[i].fix;
+      x.nofix += p.e[i].nofix;
+      x.subsumed += p.e[i].subsumed;
+      x.failed += p.e[i].failed;
+      x.prune += p.e[i].prune;
+      x.ticks += p.e[i].ticks;
+    }
+  }
+
+  void
+  PropagatorProfile::dispose(void) {
+    for (int i=0; i<n; i++)
+      heap.free<char>(e[i].name,strlen(e[i].name)+1);
+    heap.free<Entry>(e,lim);
+    n = lim = 0; e = NULL;
+  }
+
+  void
+  PropagatorProfile::record(const Propagator& p, ExecStatus es,
+                            unsigned long long int t, bool m) {
+    Entry& x = entry(typeid(p).name());
+    x.propagate++;
+    switch (es) {
+    case ES_FAILED: x.failed++; break;
+    case __ES_SUBSUMED: x.subsumed++; break;
+    case ES_FIX: x.fix++; break;
+    default: x.nofix++; break;
+    }
+    if (m)
+      x.prune++;
+    x.ticks += t;
+  }
+
+}
+
+// STATISTICS: kernel-prop
@@ -31,6 +31,12 @@
  *
  */
 
+namespace Gecode {
+
+  class Sampler;
+
+}
+
 namespace Gecode { namespace Kernel {
 
   /// Class to store data shared among several spaces
@@ -43,6 +49,8 @@ namespace Gecode { namespace Kernel {
       SharedMemory sm;
       /// The global propagator information
       GPI gpi;
+      /// The sampler used by the spaces (possibly NULL)
+      Sampler* sampler;
       /// Default constructor
       Data(void);
       /// Destructor
@@ -63,7 +71,7 @@ namespace Gecode { namespace Kernel {
 
 
   forceinline
-  SharedSpaceData::Data::Data(void) {}
+  SharedSpaceData::Data::Data(void) : sampler(NULL) {}
 
   forceinline
   SharedSpaceData::Data::~Data(void) {}
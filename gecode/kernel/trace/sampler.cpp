@@ -0,0 +1,191 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <typeinfo>
+
+#ifdef __GNUC__
+#include <cxxabi.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <signal.h>
+#include <sys/time.h>
+#define GECODE_SAMPLER_TIMER
+#endif
+
+namespace Gecode {
+
+  namespace {
+    /// Source of unique sampler identifiers
+    std::atomic<unsigned long int> sampler_ids(0);
+    /// Identifier of the sampler of the buffer cached by the thread
+    thread_local unsigned long int cached_id = 0;
+    /// Buffer cached by the thread (also used by the timer)
+    thread_local Sampler::Buffer* volatile cached = NULL;
+
+#ifdef GECODE_SAMPLER_TIMER
+    /// Record the running actor of the current thread (only signal-safe code)
+    void
+    sample_signal(int) {
+      Sampler::Buffer* b = cached;
+      if (b != NULL) {
+        void* a = b->running;
+        if (a != NULL)
+          b->record(a);
+      }
+    }
+#endif
+  }
+
+  Sampler::Buffer::Buffer(Sampler& s0)
+    : sampler(s0), next(NULL), s(heap.alloc<Sample>(s0.size)), n(0),
+      count(s0.period), thread(std::this_thread::get_id()), running(NULL) {}
+
+  void
+  Sampler::Buffer::record(void* a) {
+    // Claim a slot first such that a signal interrupting the thread
+    // writes to a different slot
+    Sample& x = s[n.fetch_add(1) % sampler.size];
+    if (Support::marked(a)) {
+      const Brancher* b = static_cast<const Brancher*>(Support::unmark(a));
+      x.type = typeid(*b).name();
+      x.gid = b->group().id();
+      x.brancher = true;
+    } else {
+      const Propagator* p = static_cast<const Propagator*>(a);
+      x.type = typeid(*p).name();
+      x.gid = p->group().id();
+      x.brancher = false;
+    }
+  }
+
+  Sampler::Sampler(unsigned int n, unsigned int s)
+    : period(n), size(std::max(s,1U)), id(++sampler_ids), b(NULL) {}
+
+  Sampler::~Sampler(void) {
+    if (cached_id == id) {
+      cached = NULL; cached_id = 0;
+    }
+    while (b != NULL) {
+      Buffer* n = b->next;
+      heap.free<Sample>(b->s,size);
+      delete b;
+      b = n;
+    }
+  }
+
+  Sampler::Buffer*
+  Sampler::buffer(void) {
+    if (cached_id == id)
+      return cached;
+    Buffer* c;
+    {
+      Support::Lock l(m);
+      std::thread::id t = std::this_thread::get_id();
+      c = b;
+      while ((c != NULL) && (c->thread != t))
+        c = c->next;
+      if (c == NULL) {
+        c = new Buffer(*this);
+        c->next = b; b = c;
+      }
+    }
+    cached = c; cached_id = id;
+    return c;
+  }
+
+  bool
+  Sampler::timer(unsigned int us) {
+#ifdef GECODE_SAMPLER_TIMER
+    struct sigaction sa;
+    memset(&sa,0,sizeof(sa));
+    sa.sa_handler = (us > 0U) ? &sample_signal : SIG_IGN;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGPROF,&sa,NULL) != 0)
+      return false;
+    struct itimerval it;
+    it.it_interval.tv_sec = us / 1000000U;
+    it.it_interval.tv_usec = us % 1000000U;
+    it.it_value = it.it_interval;
+    return setitimer(ITIMER_PROF,&it,NULL) == 0;
+#else
+    (void) us;
+    return false;
+#endif
+  }
+
+  void
+  Sampler::dump(std::ostream& os) {
+    // Count samples per actor kind, mangled class name, and group
+    typedef std::pair<std::pair<bool,std::string>,unsigned int> Key;
+    std::map<Key,unsigned long int> count;
+    {
+      Support::Lock l(m);
+      for (Buffer* c = b; c != NULL; c = c->next) {
+        unsigned long int k = std::min(c->n.load(),
+                                       static_cast<unsigned long int>(size));
+        for (unsigned long int i=0; i<k; i++) {
+          const Sample& x = c->s[i];
+          count[Key(std::make_pair(x.brancher,std::string(x.type)),x.gid)]++;
+        }
+      }
+    }
+    for (std::map<Key,unsigned long int>::const_iterator i=count.begin();
+         i != count.end(); ++i) {
+      const char* t = i->first.first.second.c_str();
+#ifdef __GNUC__
+      int status;
+      char* d = abi::__cxa_demangle(t,NULL,NULL,&status);
+      if (status == 0)
+        t = d;
+#endif
+      // Semicolons separate frames in folded stacks
+      std::string f(t);
+      std::replace(f.begin(),f.end(),';',':');
+#ifdef __GNUC__
+      free(d);
+#endif
+      os << (i->first.first.first ? "commit;" : "propagate;") << f
+         << ";group " << i->first.second << ' ' << i->second << std::endl;
+    }
+  }
+
+}
+
+// STATISTICS: kernel-trace
@@ -0,0 +1,168 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <atomic>
+#include <thread>
+
+namespace Gecode {
+
+  /**
+   * \brief Sampling profiler for propagators and branchers
+   *
+   * A sampler records which propagator or brancher a space executes.
+   * A sample is taken every \a n-th propagator execution or brancher
+   * commit, or when a SIGPROF timer expires (see Sampler::timer).
+   * Each thread records samples into a ring buffer of its own, so
+   * taking a sample neither locks nor allocates memory. The samples
+   * can be printed as folded stacks for flame graphs (see
+   * Sampler::dump).
+   *
+   * A sampler is used by a space after Space::sample has been called
+   * and by all its clones. The sampler must outlive these spaces
+   * and the timer must be stopped before the sampler is deleted.
+   *
+   * \ingroup TaskTrace
+   */
+  class GECODE_KERNEL_EXPORT Sampler : public HeapAllocated {
+  public:
+    /// A single sample
+    class Sample {
+    public:
+      /// Implementation-specific name of the class of the actor
+      const char* type;
+      /// Identifier of the group of the actor
+      unsigned int gid;
+      /// Whether the actor is a brancher
+      bool brancher;
+    };
+    /// Ring buffer of samples for a single thread
+    class Buffer : public HeapAllocated {
+    public:
+      /// The sampler the buffer belongs to
+      Sampler& sampler;
+      /// Next buffer of the same sampler
+      Buffer* next;
+      /// The samples
+      Sample* s;
+      /// Number of samples recorded (the next sample is at n modulo size)
+      std::atomic<unsigned long int> n;
+      /// Number of executions until the next sample is taken
+      unsigned int count;
+      /// Thread the buffer belongs to
+      std::thread::id thread;
+      /// The actor being executed (marked if it is a brancher)
+      void* volatile running;
+      /// Initialize for sampler \a s
+      Buffer(Sampler& s);
+      /// Record a sample for actor \a a (marked if it is a brancher)
+      void record(void* a);
+      /// Start executing propagator \a p
+      void propagate(const Propagator& p);
+      /// Start committing with brancher \a b
+      void commit(const Brancher& b);
+      /// Stop executing an actor
+      void idle(void);
+    };
+  protected:
+    /// Sampling period (0 if samples are only taken by the timer)
+    unsigned int period;
+    /// Number of samples in each buffer
+    unsigned int size;
+    /// Unique identifier of the sampler
+    unsigned long int id;
+    /// Mutex protecting the list of buffers
+    Support::Mutex m;
+    /// Buffers of all threads
+    Buffer* b;
+  public:
+    /**
+     * \brief Initialize sampler
+     *
+     * A sample is taken every \a n-th execution (no samples are
+     * taken by counting if \a n is zero). Each thread keeps the last
+     * \a s samples.
+     */
+    Sampler(unsigned int n, unsigned int s=16384U);
+    /// Delete sampler
+    ~Sampler(void);
+    /**
+     * \brief Return the buffer for the calling thread
+     *
+     * The buffer is also used for samples taken by the timer in
+     * the calling thread.
+     */
+    Buffer* buffer(void);
+    /**
+     * \brief Take a sample every \a us microseconds of CPU time
+     *
+     * Samples are taken by a SIGPROF timer for all samplers. A value
+     * of zero for \a us stops the timer. Returns false if timers
+     * are not supported by the platform.
+     */
+    static bool timer(unsigned int us);
+    /**
+     * \brief Print samples as folded stacks to \a os
+     *
+     * Each line has the form "propagate;class;group id count" or
+     * "commit;class;group id count" and can be fed to flame graph
+     * tools. The samples are kept and can be printed again.
+     */
+    void dump(std::ostream& os);
+  };
+
+  forceinline void
+  Sampler::Buffer::propagate(const Propagator& p) {
+    running = const_cast<Propagator*>(&p);
+    if ((sampler.period > 0U) && (--count == 0U)) {
+      count = sampler.period;
+      record(running);
+    }
+  }
+
+  forceinline void
+  Sampler::Buffer::commit(const Brancher& b) {
+    running = Support::mark(const_cast<Brancher*>(&b));
+    if ((sampler.period > 0U) && (--count == 0U)) {
+      count = sampler.period;
+      record(running);
+    }
+  }
+
+  forceinline void
+  Sampler::Buffer::idle(void) {
+    running = NULL;
+  }
+
+}
+
+// STATISTICS: kernel-trace
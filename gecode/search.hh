@@ -144,7 +144,8 @@ namespace Gecode { namespace Search {
    * \brief %Search engine statistics
    * \ingroup TaskModelSearch
    */
-  class Statistics : public StatusStatistics {
+  class Statistics : public StatusStatistics, public CloneStatistics,
+                     public CommitStatistics {
   public:
     /// Number of failed nodes in search tree
     unsigned long int fail;
@@ -156,6 +157,8 @@ namespace Gecode { namespace Search {
     unsigned long int restart;
     /// Number of no-goods posted
     unsigned long int nogood;
+    /// CPU time in milliseconds spent by all workers while exploring
+    double cpu;
     /// Initialize
     Statistics(void);
     /// Reset
@@ -866,6 +869,10 @@ namespace Gecode { namespace Search {
 
   /**
    * \brief %Stop-object based on time
+   *
+   * The time is wall-clock time measured by a monotonic clock. In
+   * particular, it is independent of the number of threads used
+   * by a search engine.
    * \ingroup TaskModelSearchStop
    */
   class GECODE_SEARCH_EXPORT TimeStop : public Stop {
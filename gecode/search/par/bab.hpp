@@ -151,6 +151,8 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned long int r_d = 0ul;
       typename Engine<Tracer>::Worker* wi = engine().worker(i);
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
+        // Merge failures deferred for AFC before continuing with new work
+        Kernel::GPI::flush();
         // Reset this guy
         m.acquire();
         idle = false;
@@ -230,10 +232,16 @@ namespace Gecode { namespace Search { namespace Par {
     while (true) {
       switch (engine().cmd()) {
       case C_WAIT:
+        // Stop accounting CPU time while waiting
+        m.acquire();
+        this->cpu_stop();
+        m.release();
         // Wait
         engine().wait();
         break;
       case C_TERMINATE:
+        // Merge failures deferred for AFC
+        Kernel::GPI::flush();
         // Acknowledge termination request
         engine().ack_terminate();
         // Wait until termination can proceed
@@ -241,6 +249,11 @@ namespace Gecode { namespace Search { namespace Par {
         // Thread will be terminated by returning from run
         return;
       case C_RESET:
+        m.acquire();
+        this->cpu_stop();
+        m.release();
+        // Merge failures deferred for AFC
+        Kernel::GPI::flush();
         // Acknowledge reset request
         engine().ack_reset_start();
         // Wait until reset has been performed
@@ -252,6 +265,9 @@ namespace Gecode { namespace Search { namespace Par {
         // Perform exploration work
         {
           m.acquire();
+          // CPU time is only accounted while having work
+          if (!idle)
+            this->cpu_start();
           if (idle) {
             m.release();
             // Try to find new work
@@ -310,7 +326,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(*this);
                     d = 1;
                   } else {
                     c = NULL;
@@ -322,7 +338,7 @@ namespace Gecode { namespace Search { namespace Par {
                                               tracer.wid(), nid, *cur, ch);
                     tracer.node(ei,ni);
                   }
-                  cur->commit(*ch,0);
+                  cur->commit(*ch,0,*this);
                   m.release();
                 }
                 break;
@@ -338,6 +354,7 @@ namespace Gecode { namespace Search { namespace Par {
           } else {
             idle = true;
             path.ngdl(0);
+            this->cpu_stop();
             m.release();
             // Report that worker is idle
             engine().idle();
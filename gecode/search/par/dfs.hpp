@@ -125,6 +125,8 @@ namespace Gecode { namespace Search { namespace Par {
       unsigned long int r_d = 0ul;
       typename Engine<Tracer>::Worker* wi = engine().worker(i);
       if (Space* s = wi->steal(r_d,wi->tracer,tracer)) {
+        // Merge failures deferred for AFC before continuing with new work
+        Kernel::GPI::flush();
         // Reset this guy
         m.acquire();
         idle = false;
@@ -178,10 +180,16 @@ namespace Gecode { namespace Search { namespace Par {
     while (true) {
       switch (engine().cmd()) {
       case C_WAIT:
+        // Stop accounting CPU time while waiting
+        m.acquire();
+        this->cpu_stop();
+        m.release();
         // Wait
         engine().wait();
         break;
       case C_TERMINATE:
+        // Merge failures deferred for AFC
+        Kernel::GPI::flush();
         // Acknowledge termination request
         engine().ack_terminate();
         // Wait until termination can proceed
@@ -189,6 +197,11 @@ namespace Gecode { namespace Search { namespace Par {
         // Thread will be terminated by returning from run
         return;
       case C_RESET:
+        m.acquire();
+        this->cpu_stop();
+        m.release();
+        // Merge failures deferred for AFC
+        Kernel::GPI::flush();
         // Acknowledge reset request
         engine().ack_reset_start();
         // Wait until reset has been performed
@@ -200,6 +213,9 @@ namespace Gecode { namespace Search { namespace Par {
         // Perform exploration work
         {
           m.acquire();
+          // CPU time is only accounted while having work
+          if (!idle)
+            this->cpu_start();
           if (idle) {
             m.release();
             // Try to find new work
@@ -258,7 +274,7 @@ namespace Gecode { namespace Search { namespace Par {
                 {
                   Space* c;
                   if ((d == 0) || (d >= engine().opt().c_d)) {
-                    c = cur->clone();
+                    c = cur->clone(*this);
                     d = 1;
                   } else {
                     c = NULL;
@@ -270,7 +286,7 @@ namespace Gecode { namespace Search { namespace Par {
                                               tracer.wid(), nid, *cur, ch);
                     tracer.node(ei,ni);
                   }
-                  cur->commit(*ch,0);
+                  cur->commit(*ch,0,*this);
                   m.release();
                 }
                 break;
@@ -286,6 +302,7 @@ namespace Gecode { namespace Search { namespace Par {
           } else {
             idle = true;
             path.ngdl(0);
+            this->cpu_stop();
             m.release();
             // Report that worker is idle
             engine().idle();
@@ -137,11 +137,19 @@ namespace Gecode { namespace Search { namespace Par {
     /// Unwind the stack up to position \a l (after failure)
     void unwind(int l, Tracer& t);
     /// Commit space \a s as described by stack entry at position \a i
-    void commit(Space* s, int i) const;
-    /// Recompute space according to path
+    void commit(Worker& stat, Space* s, int i) const;
+    /**
+     * \brief Recompute space according to path
+     *
+     * All choices from the last clone are committed without
+     * propagation in between, the returned space is propagated only
+     * once by the engine. With adaptive recomputation the space is
+     * propagated once more in the middle of the path to create an
+     * additional clone.
+     */
     Space* recompute(unsigned int& d, unsigned int a_d, Worker& s,
                      Tracer& t);
-    /// Recompute space according to path
+    /// Recompute space according to path (see above), also constrain by \a best
     Space* recompute(unsigned int& d, unsigned int a_d, Worker& s,
                      const Space& best, int& mark,
                      Tracer& t);
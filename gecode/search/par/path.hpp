@@ -185,9 +185,9 @@ namespace Gecode { namespace Search { namespace Par {
 
   template<class Tracer>
   forceinline void
-  Path<Tracer>::commit(Space* s, int i) const {
+  Path<Tracer>::commit(Worker& stat, Space* s, int i) const {
     const Edge& n = ds[i];
-    s->commit(*n.choice(),n.alt());
+    s->commit(*n.choice(),n.alt(),stat);
   }
 
   template<class Tracer>
@@ -263,12 +263,12 @@ namespace Gecode { namespace Search { namespace Par {
         // Find last copy
         while (ds[l].space() == NULL)
           l--;
-        Space* c = ds[l].space()->clone();
+        Space* c = ds[l].space()->clone(stat);
         // Recompute, if necessary
         for (int i=l; i<n; i++)
-          commit(c,i);
+          commit(stat,c,i);
         unsigned int a = ds[n].steal();
-        c->commit(*ds[n].choice(),a);
+        c->commit(*ds[n].choice(),a,stat);
         if (!ds[n].work())
           n_work--;
         // No no-goods can be extracted above n
@@ -295,7 +295,7 @@ namespace Gecode { namespace Search { namespace Par {
     // Check for LAO
     if ((ds.top().space() != NULL) && ds.top().rightmost()) {
       Space* s = ds.top().space();
-      s->commit(*ds.top().choice(),ds.top().alt());
+      s->commit(*ds.top().choice(),ds.top().alt(),stat);
       assert(ds.entries()-1 == lc());
       ds.top().space(NULL);
       // Mark as reusable
@@ -310,21 +310,21 @@ namespace Gecode { namespace Search { namespace Par {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     } else {
       int m = l + static_cast<int>(d >> 1); // Middle between copy and top
       int i = l; // To iterate over all entries
       // Recompute up to middle
       for (; i<m; i++ )
-        commit(s,i);
+        commit(stat,s,i);
       // Skip over all rightmost branches
       for (; (i<n) && ds[i].rightmost(); i++)
-        commit(s,i);
+        commit(stat,s,i);
       // Is there any point to make a copy?
       if (i<n-1) {
         // Propagate to fixpoint
@@ -340,12 +340,12 @@ namespace Gecode { namespace Search { namespace Par {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     }
     return s;
   }
@@ -362,7 +362,7 @@ namespace Gecode { namespace Search { namespace Par {
     // Check for LAO
     if ((ds.top().space() != NULL) && ds.top().rightmost()) {
       Space* s = ds.top().space();
-      s->commit(*ds.top().choice(),ds.top().alt());
+      s->commit(*ds.top().choice(),ds.top().alt(),stat);
       assert(ds.entries()-1 == lc());
       if (mark > ds.entries()-1) {
         mark = ds.entries()-1;
@@ -397,25 +397,25 @@ namespace Gecode { namespace Search { namespace Par {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(stat);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = s->clone(stat);
     }
 
     if (d < a_d) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     } else {
       int m = l + static_cast<int>(d >> 1); // Middle between copy and top
       int i = l;            // To iterate over all entries
       // Recompute up to middle
       for (; i<m; i++ )
-        commit(s,i);
+        commit(stat,s,i);
       // Skip over all rightmost branches
       for (; (i<n) && ds[i].rightmost(); i++)
-        commit(s,i);
+        commit(stat,s,i);
       // Is there any point to make a copy?
       if (i<n-1) {
         // Propagate to fixpoint
@@ -434,12 +434,12 @@ namespace Gecode { namespace Search { namespace Par {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     }
     return s;
   }
@@ -136,7 +136,7 @@ namespace Gecode { namespace Search { namespace Seq {
         {
           Space* c;
           if ((d == 0) || (d >= opt.c_d)) {
-            c = cur->clone();
+            c = cur->clone(*this);
             d = 1;
           } else {
             c = NULL;
@@ -148,7 +148,7 @@ namespace Gecode { namespace Search { namespace Seq {
                                       tracer.wid(), nid, *cur, ch);
             tracer.node(ei,ni);
           }
-          cur->commit(*ch,0);
+          cur->commit(*ch,0,*this);
           break;
         }
       default:
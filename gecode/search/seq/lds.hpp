@@ -155,14 +155,14 @@ namespace Gecode { namespace Search { namespace Seq {
           cur = ds.pop().space();
           if (tracer)
             tracer.ei()->init(tracer.wid(), nid, 0, *cur, *ch);
-          cur->commit(*ch,0);
+          cur->commit(*ch,0,*this);
           delete ch;
         } else {
           ds.top().next();
-          cur = ds.top().space()->clone();
+          cur = ds.top().space()->clone(*this);
           if (tracer)
             tracer.ei()->init(tracer.wid(), nid, a, *cur, *ch);
-          cur->commit(*ch,a);
+          cur->commit(*ch,a,*this);
         }
         node++;
         d++;
@@ -186,7 +186,7 @@ namespace Gecode { namespace Search { namespace Seq {
             if (tracer)
               tracer.ei()->init(tracer.wid(), nid, 0, *cur, *ch);
           }
-          s->commit(*ch,0);
+          s->commit(*ch,0,*this);
           node++;
           delete ch;
         }
@@ -244,18 +244,18 @@ namespace Gecode { namespace Search { namespace Seq {
               if (d < alt-1)
                 exhausted = false;
               unsigned int d_a = (d >= alt-1) ? alt-1 : d;
-              Space* cc = cur->clone();
+              Space* cc = cur->clone(*this);
               Node sn(cc,ch,d_a-1,nid);
               ds.push(sn);
               stack_depth(static_cast<unsigned long int>(ds.entries()));
               if (tracer)
                 tracer.ei()->init(tracer.wid(), nid, d_a, *cur, *ch);
-              cur->commit(*ch,d_a);
+              cur->commit(*ch,d_a,*this);
               d -= d_a;
             } else {
               if (tracer)
                 tracer.ei()->init(tracer.wid(), nid, 0, *cur, *ch);
-              cur->commit(*ch,0);
+              cur->commit(*ch,0,*this);
               node++;
               delete ch;
             }
@@ -287,10 +287,12 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   Space*
   LDS<Tracer>::next(void) {
+    e.cpu_start();
+    Space* s;
     while (true) {
-      Space* s = e.next(opt);
+      s = e.next(opt);
       if (s != NULL)
-        return s;
+        break;
       if (((s == NULL) && e.stopped()) || (++d > opt.d_l) || e.done())
         break;
       if (d == opt.d_l) {
@@ -301,7 +303,8 @@ namespace Gecode { namespace Search { namespace Seq {
         e.reset(root->clone(),d);
       }
     }
-    return NULL;
+    e.cpu_stop();
+    return s;
   }
 
   template<class Tracer>
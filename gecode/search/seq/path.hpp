@@ -171,9 +171,9 @@ namespace Gecode { namespace Search { namespace Seq {
 
   template<class Tracer>
   forceinline void
-  Path<Tracer>::commit(Space* s, int i) const {
+  Path<Tracer>::commit(Worker& stat, Space* s, int i) const {
     const Edge& n = ds[i];
-    s->commit(*n.choice(),n.alt());
+    s->commit(*n.choice(),n.alt(),stat);
   }
 
   template<class Tracer>
@@ -231,7 +231,7 @@ namespace Gecode { namespace Search { namespace Seq {
     // Check for LAO
     if ((ds.top().space() != NULL) && ds.top().rightmost()) {
       Space* s = ds.top().space();
-      s->commit(*ds.top().choice(),ds.top().alt());
+      s->commit(*ds.top().choice(),ds.top().alt(),stat);
       assert(ds.entries()-1 == lc());
       ds.top().space(NULL);
       // Mark as reusable
@@ -246,21 +246,21 @@ namespace Gecode { namespace Search { namespace Seq {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
-    Space* s = ds[l].space()->clone(); // Last clone
+    Space* s = ds[l].space()->clone(stat); // Last clone
 
     if (d < a_d) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     } else {
       int m = l + static_cast<int>(d >> 1); // Middle between copy and top
       int i = l; // To iterate over all entries
       // Recompute up to middle
       for (; i<m; i++ )
-        commit(s,i);
+        commit(stat,s,i);
       // Skip over all rightmost branches
       for (; (i<n) && ds[i].rightmost(); i++)
-        commit(s,i);
+        commit(stat,s,i);
       // Is there any point to make a copy?
       if (i<n-1) {
         // Propagate to fixpoint
@@ -276,12 +276,12 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     }
     return s;
   }
@@ -298,7 +298,7 @@ namespace Gecode { namespace Search { namespace Seq {
     // Check for LAO
     if ((ds.top().space() != NULL) && ds.top().rightmost()) {
       Space* s = ds.top().space();
-      s->commit(*ds.top().choice(),ds.top().alt());
+      s->commit(*ds.top().choice(),ds.top().alt(),stat);
       assert(ds.entries()-1 == lc());
       if (mark > ds.entries()-1) {
         mark = ds.entries()-1;
@@ -333,25 +333,25 @@ namespace Gecode { namespace Search { namespace Seq {
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
-      Space* c = s->clone();
+      Space* c = s->clone(stat);
       ds[l].space(c);
     } else {
-      s = s->clone();
+      s = s->clone(stat);
     }
 
     if (d < a_d) {
       // No adaptive recomputation
       for (int i=l; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     } else {
       int m = l + static_cast<int>(d >> 1); // Middle between copy and top
       int i = l;            // To iterate over all entries
       // Recompute up to middle
       for (; i<m; i++ )
-        commit(s,i);
+        commit(stat,s,i);
       // Skip over all rightmost branches
       for (; (i<n) && ds[i].rightmost(); i++)
-        commit(s,i);
+        commit(stat,s,i);
       // Is there any point to make a copy?
       if (i<n-1) {
         // Propagate to fixpoint
@@ -370,12 +370,12 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        ds[i].space(s->clone(stat));
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
       for (; i<n; i++)
-        commit(s,i);
+        commit(stat,s,i);
     }
     return s;
   }
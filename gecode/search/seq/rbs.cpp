@@ -92,6 +92,8 @@ namespace Gecode { namespace Search { namespace Seq {
         // The engine must perform a true restart
         // The number of the restart has been incremented in the stop object
         sslr = 0;
+        // Merge failures deferred for AFC
+        Kernel::GPI::flush();
         NoGoods& ng = e->nogoods();
         ng.ng(0);
         MetaInfo mi(stop->m_stat.restart,sslr,e->statistics().fail,last,ng);
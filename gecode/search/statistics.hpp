@@ -38,22 +38,27 @@ namespace Gecode { namespace Search {
   forceinline void
   Statistics::reset(void) {
     StatusStatistics::reset();
-    fail=0; node=0; depth=0; restart=0; nogood=0;
+    CloneStatistics::reset();
+    CommitStatistics::reset();
+    fail=0; node=0; depth=0; restart=0; nogood=0; cpu=0.0;
   }
 
   forceinline
   Statistics::Statistics(void)
     : fail(0), node(0), depth(0),
-      restart(0), nogood(0) {}
+      restart(0), nogood(0), cpu(0.0) {}
 
   forceinline Statistics&
   Statistics::operator +=(const Statistics& s) {
     (void) StatusStatistics::operator +=(s);
+    (void) CloneStatistics::operator +=(s);
+    (void) CommitStatistics::operator +=(s);
     fail += s.fail;
     node += s.node;
     depth = std::max(depth,s.depth);
     restart += s.restart;
     nogood += s.nogood;
+    cpu += s.cpu;
     return *this;
   }
 
@@ -79,7 +79,10 @@ namespace Gecode { namespace Search {
   template<class Worker>
   Space*
   WorkerToEngine<Worker>::next(void) {
-    return w.next();
+    w.cpu_start();
+    Space* s = w.next();
+    w.cpu_stop();
+    return s;
   }
   template<class Worker>
   Search::Statistics
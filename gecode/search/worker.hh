@@ -47,6 +47,8 @@ namespace Gecode { namespace Search {
     bool _stopped;
     /// Depth of root node (for work stealing)
     unsigned long int root_depth;
+    /// CPU time of the thread when it has started working (negative if idle)
+    double cpu_t0;
   public:
     /// Initialize
     Worker(void);
@@ -62,13 +64,20 @@ namespace Gecode { namespace Search {
     void stack_depth(unsigned long int d);
     /// Return steal depth
     unsigned long int steal_depth(unsigned long int d) const;
+    /// \name CPU time accounting (must be called by the working thread)
+    //@{
+    /// Start accounting CPU time, if not already started
+    void cpu_start(void);
+    /// Stop accounting CPU time and add it to the statistics
+    void cpu_stop(void);
+    //@}
   };
 
 
 
   forceinline
   Worker::Worker(void)
-    : _stopped(false), root_depth(0) {}
+    : _stopped(false), root_depth(0), cpu_t0(-1.0) {}
 
   forceinline void
   Worker::start(void) {
@@ -107,6 +116,20 @@ namespace Gecode { namespace Search {
     return root_depth + d;
   }
 
+  forceinline void
+  Worker::cpu_start(void) {
+    if (cpu_t0 < 0.0)
+      cpu_t0 = Support::cputime();
+  }
+
+  forceinline void
+  Worker::cpu_stop(void) {
+    if (cpu_t0 >= 0.0) {
+      cpu += Support::cputime() - cpu_t0;
+      cpu_t0 = -1.0;
+    }
+  }
+
 }}
 
 #endif
@@ -1701,6 +1701,26 @@ namespace Gecode {
          const Symmetries& syms,
          SetBranchFilter bf=nullptr,
          SetVarValPrint vvp=nullptr);
+  /**
+   * \brief Branch over \a x with variable selection \a vars and value
+   * selection \a vals with symmetry breaking by dominance detection
+   *
+   * The symmetries must be symmetries of the whole problem and the
+   * brancher should be the first brancher posted, see the integer
+   * variant for details.
+   *
+   * Throws LDSBBadValueSelection exception if \a vals is any of
+   * SEL_MIN_EXC, SEL_MED_EXC, SEL_MAX_EXC, and SEL_RND_EXC, or if
+   * \a vals is SEL_VAL_COMMIT with a custom commit function.
+   *
+   * \ingroup TaskModelSetBranch
+   */
+  GECODE_SET_EXPORT void
+  sbdd(Home home, const SetVarArgs& x,
+       SetVarBranch vars, SetValBranch vals,
+       const Symmetries& syms,
+       SetBranchFilter bf=nullptr,
+       SetVarValPrint vvp=nullptr);
 }
 
 namespace Gecode {
@@ -60,6 +60,10 @@ namespace Gecode { namespace Int { namespace LDSB {
   ModEvent prune<Set::SetView>(Space& home, Set::SetView x, int v) {
     return x.exclude(home, v);
   }
+  template <>
+  bool entailed<Set::SetView>(Set::SetView x, int v) {
+    return x.contains(v);
+  }
 }}}
 
 namespace Gecode { namespace Set { namespace LDSB {
@@ -229,6 +233,42 @@ namespace Gecode {
     }
   }
 
+  void
+  sbdd(Home home, const SetVarArgs& x,
+       SetVarBranch vars, SetValBranch vals,
+       const Symmetries& syms,
+       SetBranchFilter bf,
+       SetVarValPrint vvp) {
+    using namespace Set;
+    if (home.failed()) return;
+    vars.expand(home,x);
+    switch (vals.select()) {
+    case SetValBranch::SEL_MIN_EXC:
+    case SetValBranch::SEL_MED_EXC:
+    case SetValBranch::SEL_MAX_EXC:
+    case SetValBranch::SEL_RND_EXC:
+      throw Int::LDSBBadValueSelection("Set::LDSB::sbdd");
+      break;
+    case SetValBranch::SEL_VAL_COMMIT:
+      if (vals.commit())
+        throw Int::LDSBBadValueSelection("Set::LDSB::sbdd");
+      // Without a commit function the left alternative includes n
+    default:
+      {
+        ArgArray<VarImpBase*> xi(x.size());
+        for (int i=0; i<x.size(); i++)
+          xi[i] = x[i].varimp();
+        SBDDSymmetries s(syms,xi);
+        ViewArray<SetView> xv(home,x);
+        ViewSel<SetView>* vs[1] = {
+          Branch::viewsel(home,vars)
+        };
+        postsbddbrancher<SetView,PC_SET_CGLB,1,int,2>
+          (home,xv,vs,Branch::valselcommit(home,vals),s,bf,vvp);
+      }
+    }
+  }
+
 }
 
 // STATISTICS: set-branch
@@ -133,9 +133,10 @@ namespace Gecode { namespace Set { namespace LDSB {
 namespace Gecode { namespace Int { namespace LDSB {
 
   template <>
-  ArgArray<Literal>
+  void
   VariableSequenceSymmetryImp<Set::SetView>
-  ::symmetric(Literal l, const ViewArray<Set::SetView>& x) const;
+  ::symmetric(Literal l, const ViewArray<Set::SetView>& x,
+              LiteralStack& s) const;
 
 }}}
 
@@ -52,105 +52,37 @@ namespace Gecode { namespace Set { namespace LDSB {
 // Gecode::Set::LDSB.
 namespace Gecode { namespace Int { namespace LDSB {
   template <>
-  ArgArray<Literal>
-  VariableSymmetryImp<Set::SetView>
-  ::symmetric(Literal l, const ViewArray<Set::SetView>& x) const {
-    (void) x;
-    if (indices.valid(l._variable) && indices.get(l._variable)) {
-      int n = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(indices) ; i() ; ++i)
-        n++;
-      ArgArray<Literal> lits(n);
-      int j = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(indices) ; i() ; ++i) {
-        lits[j++] = Literal(i.val(), l._value);
-      }
-      return lits;
-    } else {
-      return ArgArray<Literal>(0);
-    }
-  }
-
-  template <>
-  ArgArray<Literal>
-  ValueSymmetryImp<Set::SetView>
-  ::symmetric(Literal l, const ViewArray<Set::SetView>& x) const {
-    (void) x;
-    if (values.valid(l._value) && values.get(l._value)) {
-      int n = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(values) ; i() ; ++i)
-        n++;
-      ArgArray<Literal> lits(n);
-      int j = 0;
-      for (Iter::Values::BitSetOffset<Support::BitSetOffset<Space> > i(values) ; i() ; ++i) {
-        lits[j++] = Literal(l._variable, i.val());
-      }
-      return lits;
-    } else {
-      return ArgArray<Literal>(0);
-    }
-  }
-
-  template <>
-  ArgArray<Literal>
+  void
   VariableSequenceSymmetryImp<Set::SetView>
-  ::symmetric(Literal l, const ViewArray<Set::SetView>& x) const {
-    Region region;
-    Support::DynamicStack<Literal,Region> s(region);
-    if (l._variable < (int)lookup_size) {
-      int posIt = lookup[l._variable];
-      if (posIt == -1) {
-        return dynamicStackToArgArray(s);
-      }
-      unsigned int seqNum = posIt / seq_size;
-      unsigned int seqPos = posIt % seq_size;
-      for (unsigned int seq = 0 ; seq < n_seqs ; seq++) {
-        if (seq == seqNum) {
-          continue;
-        }
-        if (x[getVal(seq, seqPos)].assigned()) {
-          continue;
-        }
-        bool active = true;
-        const unsigned int *firstSeq = &indices[seqNum*seq_size];
-        const unsigned int *secondSeq = &indices[seq*seq_size];
-        for (unsigned int i = 0 ; i < seq_size ; i++) {
-          const Set::SetView& xv = x[firstSeq[i]];
-          const Set::SetView& yv = x[secondSeq[i]];
-          if ((!xv.assigned() && !yv.assigned())
-              || (xv.assigned() && yv.assigned() && Set::LDSB::equalLUB(xv, yv))) {
-            continue;
-          } else {
-            active = false;
-            break;
-          }
-        }
-
-        if (active) {
-          s.push(Literal(secondSeq[seqPos], l._value));
+  ::symmetric(Literal l, const ViewArray<Set::SetView>& x,
+              LiteralStack& s) const {
+    int posIt = indices.first(l._variable);
+    if (posIt == -1)
+      return;
+    int seq_size = indices.seq_size();
+    int seqNum = posIt / seq_size;
+    int seqPos = posIt % seq_size;
+    const int* firstSeq = indices.seq(seqNum);
+    for (int seq = 0 ; seq < indices.n_seqs() ; seq++) {
+      if (seq == seqNum)
+        continue;
+      const int* secondSeq = indices.seq(seq);
+      if (x[secondSeq[seqPos]].assigned())
+        continue;
+      bool active = true;
+      for (int i = 0 ; i < seq_size ; i++) {
+        const Set::SetView& xv = x[firstSeq[i]];
+        const Set::SetView& yv = x[secondSeq[i]];
+        if (!((!xv.assigned() && !yv.assigned())
+              || (xv.assigned() && yv.assigned() &&
+                  Set::LDSB::equalLUB(xv, yv)))) {
+          active = false;
+          break;
         }
       }
+      if (active)
+        s.push(Literal(secondSeq[seqPos], l._value));
     }
-    return dynamicStackToArgArray(s);
-  }
-
-  template <>
-  ArgArray<Literal>
-  ValueSequenceSymmetryImp<Set::SetView>
-  ::symmetric(Literal l, const ViewArray<Set::SetView>& x) const {
-    (void) x;
-    Region region;
-    Support::DynamicStack<Literal,Region> s(region);
-    std::pair<int,int> location = findVar(values, n_values, seq_size, l._value);
-    if (location.first == -1) return dynamicStackToArgArray(s);
-    unsigned int seqNum = location.first;
-    unsigned int seqPos = location.second;
-    for (unsigned int seq = 0 ; seq < n_seqs ; seq++) {
-      if (seq == seqNum) continue;
-      if (dead_sequences.get(seq)) continue;
-      s.push(Literal(l._variable, getVal(seq,seqPos)));
-    }
-    return dynamicStackToArgArray(s);
   }
 }}}
 
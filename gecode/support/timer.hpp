@@ -31,30 +31,31 @@
  *
  */
 
-#ifdef GECODE_USE_GETTIMEOFDAY
-#include <sys/time.h>
+#include <chrono>
+#include <ctime>
+
+#ifdef GECODE_HAS_UNISTD_H
+#include <unistd.h>
 #endif
 
-#ifdef GECODE_USE_CLOCK
-#include <ctime>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
 #endif
 
 namespace Gecode { namespace Support {
 
   /** \brief %Timer
    *
-   * This class represents a best-effort at measuring wall-clock time
-   * in milliseconds.
+   * This class measures wall-clock time in milliseconds with a
+   * monotonic clock. The time measured does neither depend on how
+   * many threads are running nor on changes to the system time.
    *
    * \ingroup FuncSupport
    */
   class GECODE_SUPPORT_EXPORT Timer {
   private:
-#if   defined(GECODE_USE_GETTIMEOFDAY)
-    timeval t0; ///< Start time
-#elif defined(GECODE_USE_CLOCK)
-    clock_t t0; ///< Start time
-#endif
+    /// Start time
+    std::chrono::steady_clock::time_point t0;
   public:
     /// Start timer
     void start(void);
@@ -62,36 +63,70 @@ namespace Gecode { namespace Support {
     double stop(void);
   };
 
+  /** \brief Return a time stamp in ticks
+   *
+   * Ticks are read from the processor's time-stamp counter if
+   * available and are nanoseconds of a steady clock otherwise.
+   * Only differences between time stamps are meaningful.
+   *
+   * \ingroup FuncSupport
+   */
+  unsigned long long int ticks(void);
+
+  /** \brief Return the CPU time used by the calling thread in milliseconds
+   *
+   * If the platform does not support CPU time per thread, the CPU
+   * time used by the process is returned instead. Only differences
+   * between CPU times of the same thread are meaningful.
+   *
+   * \ingroup FuncSupport
+   */
+  double cputime(void);
+
   inline void
   Timer::start(void) {
-#if   defined(GECODE_USE_GETTIMEOFDAY)
-    if (gettimeofday(&t0, NULL))
-      throw OperatingSystemError("Timer::start[gettimeofday]");
-#elif defined(GECODE_USE_CLOCK)
-    t0 = clock();
-#endif
+    t0 = std::chrono::steady_clock::now();
   }
 
   inline double
   Timer::stop(void) {
-#if   defined(GECODE_USE_GETTIMEOFDAY)
-    timeval t1, t;
-    if (gettimeofday(&t1, NULL))
-      throw OperatingSystemError("Timer::stop[gettimeofday]");
+    return std::chrono::duration<double,std::milli>
+      (std::chrono::steady_clock::now() - t0).count();
+  }
 
-    // t = t1 - t2
-    t.tv_sec = t1.tv_sec - t0.tv_sec;
-    t.tv_usec = t1.tv_usec - t0.tv_usec;
-    if (t.tv_usec < 0) {
-      t.tv_sec--;
-      t.tv_usec += 1000000;
-    }
+  inline unsigned long long int
+  ticks(void) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    unsigned int lo, hi;
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return (static_cast<unsigned long long int>(hi) << 32) | lo;
+#else
+    return static_cast<unsigned long long int>
+      (std::chrono::duration_cast<std::chrono::nanoseconds>
+       (std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+  }
 
-    return (static_cast<double>(t.tv_sec) * 1000.0) +
-      (static_cast<double>(t.tv_usec)/1000.0);
-#elif defined(GECODE_USE_CLOCK)
-    return (static_cast<double>(clock()-t0) / CLOCKS_PER_SEC) * 1000.0;
+  inline double
+  cputime(void) {
+#if defined(_POSIX_THREAD_CPUTIME) && (_POSIX_THREAD_CPUTIME >= 0)
+    timespec t;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID,&t) == 0)
+      return (static_cast<double>(t.tv_sec) * 1000.0) +
+        (static_cast<double>(t.tv_nsec) / 1000000.0);
+#elif defined(GECODE_THREADS_WINDOWS)
+    FILETIME c, e, k, u;
+    if (GetThreadTimes(GetCurrentThread(),&c,&e,&k,&u)) {
+      // Kernel and user time are given in units of 100 nanoseconds
+      ULARGE_INTEGER tk, tu;
+      tk.LowPart = k.dwLowDateTime; tk.HighPart = k.dwHighDateTime;
+      tu.LowPart = u.dwLowDateTime; tu.HighPart = u.dwHighDateTime;
+      return static_cast<double>(tk.QuadPart + tu.QuadPart) / 10000.0;
+    }
 #endif
+    return (static_cast<double>(clock()) / CLOCKS_PER_SEC) * 1000.0;
   }
 
 }}
@@ -134,6 +134,56 @@ namespace Test {
 
   AFC afc;
 
+  /// %Test for merging deferred failures into %AFC information
+  class AFCMerge : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Two integer variables
+      Gecode::IntVar x, y;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,0,10), y(*this,0,10) {
+        Gecode::rel(*this, x, Gecode::IRT_LE, y);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+        y.update(*this,s.y);
+      }
+      /// Clone and fail the clone
+      void fail(void) {
+        TestSpace* c = static_cast<TestSpace*>(clone());
+        Gecode::rel(*c, c->y, Gecode::IRT_LQ, 0);
+        (void) c->status();
+        delete c;
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+  public:
+    /// Initialize test
+    AFCMerge(void) : Test::Base("AFC::Merge") {}
+    /// Perform actual tests
+    bool run(void) {
+      TestSpace* a = new TestSpace;
+      TestSpace* b = new TestSpace;
+      a->afc_decay(0.95); b->afc_decay(0.95);
+      b->afc_merge(2U + rand(8U));
+      for (int n=static_cast<int>(rand(64U)); n--; ) {
+        a->fail(); b->fail();
+      }
+      Gecode::Kernel::GPI::flush();
+      bool same = (a->x.afc() == b->x.afc()) && (a->y.afc() == b->y.afc());
+      delete a; delete b;
+      return same;
+    }
+  };
+
+  AFCMerge afc_merge;
+
 }
 
 // STATISTICS: test-core
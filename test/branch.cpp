@@ -185,7 +185,9 @@ namespace Test { namespace Branch {
     "INT_VAR_REGRET_MIN_MIN",
     "INT_VAR_REGRET_MIN_MAX",
     "INT_VAR_REGRET_MAX_MIN",
-    "INT_VAR_REGRET_MAX_MAX"
+    "INT_VAR_REGRET_MAX_MAX",
+    "INT_VAR_LAST_CONFLICT",
+    "INT_VAR_CONFLICT_ORDER"
   };
   /// Number of integer variable selections
   const int n_int_var_branch =
@@ -204,7 +206,9 @@ namespace Test { namespace Branch {
     "BOOL_VAR_ACTION_MIN",
     "BOOL_VAR_ACTION_MAX",
     "BOOL_VAR_CHB_MIN",
-    "BOOL_VAR_CHB_MAX"
+    "BOOL_VAR_CHB_MAX",
+    "BOOL_VAR_LAST_CONFLICT",
+    "BOOL_VAR_CONFLICT_ORDER"
   };
   /// Number of integer variable selections
   const int n_bool_var_branch =
@@ -227,6 +231,7 @@ namespace Test { namespace Branch {
     "INT_VAL_SPLIT_MAX",
     "INT_VAL_RANGE_MIN",
     "INT_VAL_RANGE_MAX",
+    "INT_VAL_PHASE",
     "INT_VAL",
     "INT_VALUES_MIN",
     "INT_VALUES_MAX"
@@ -239,6 +244,7 @@ namespace Test { namespace Branch {
     "BOOL_VAL_MIN",
     "BOOL_VAL_MAX",
     "BOOL_VAL_RND",
+    "BOOL_VAL_PHASE",
     "BOOL_VAL"
   };
   /// Number of Boolean value selections
@@ -465,14 +471,15 @@ namespace Test { namespace Branch {
           case  5: ivb = INT_VAL_SPLIT_MAX(); break;
           case  6: ivb = INT_VAL_RANGE_MIN(); break;
           case  7: ivb = INT_VAL_RANGE_MAX(); break;
-          case  8: ivb = INT_VAL(&int_val); break;
-          case  9: ivb = INT_VALUES_MIN(); break;
-          case 10: ivb = INT_VALUES_MAX(); break;
+          case  8: ivb = INT_VAL_PHASE(); break;
+          case  9: ivb = INT_VAL(&int_val); break;
+          case 10: ivb = INT_VALUES_MIN(); break;
+          case 11: ivb = INT_VALUES_MAX(); break;
           }
 
           IntTestSpace* c = static_cast<IntTestSpace*>(root->clone());
 
-          if ((vara == 0) && (val < 11)) {
+          if ((vara == 0) && (val < 12)) {
             for (int i=0; i<c->x.size(); i++)
               branch(*c, c->x[i], ivb);
           } else {
@@ -480,6 +487,7 @@ namespace Test { namespace Branch {
             IntVarBranch ivba;
             IntAction iaa(*c, c->x, 0.9);
             IntCHB ica(*c, c->x);
+            IntConflict ifa(*c, c->x, 2);
             switch (vara) {
             case  0: ivba = INT_VAR_NONE(); break;
             case  1: ivba = INT_VAR_NONE(); break;
@@ -512,6 +520,8 @@ namespace Test { namespace Branch {
             case 28: ivba = INT_VAR_REGRET_MIN_MAX(); break;
             case 29: ivba = INT_VAR_REGRET_MAX_MIN(); break;
             case 30: ivba = INT_VAR_REGRET_MAX_MAX(); break;
+            case 31: ivba = INT_VAR_LAST_CONFLICT(ifa); break;
+            case 32: ivba = INT_VAR_CONFLICT_ORDER(); break;
             }
 
             Rnd rb(2);
@@ -550,6 +560,8 @@ namespace Test { namespace Branch {
             case 28: ivbb = INT_VAR_REGRET_MIN_MAX(&tbl); break;
             case 29: ivbb = INT_VAR_REGRET_MAX_MIN(&tbl); break;
             case 30: ivbb = INT_VAR_REGRET_MAX_MAX(&tbl); break;
+            case 31: ivbb = INT_VAR_LAST_CONFLICT(1,&tbl); break;
+            case 32: ivbb = INT_VAR_CONFLICT_ORDER(&tbl); break;
             }
 
             switch (Base::rand(9U)) {
@@ -631,7 +643,8 @@ namespace Test { namespace Branch {
           case  0: bvb = BOOL_VAL_MIN(); break;
           case  1: bvb = BOOL_VAL_MAX(); break;
           case  2: bvb = BOOL_VAL_RND(r); break;
-          case  3: bvb = BOOL_VAL(&bool_val); break;
+          case  3: bvb = BOOL_VAL_PHASE(); break;
+          case  4: bvb = BOOL_VAL(&bool_val); break;
           }
 
           BoolTestSpace* c = static_cast<BoolTestSpace*>(root->clone());
@@ -646,6 +659,7 @@ namespace Test { namespace Branch {
             BoolVarBranch bvba;
             BoolAction baa(*c, c->x, 0.9);
             BoolCHB bca(*c, c->x);
+            BoolConflict bfa(*c, c->x, 2);
             switch (vara) {
             case  0: bvba = BOOL_VAR_NONE(); break;
             case  1: bvba = BOOL_VAR_NONE(); break;
@@ -660,6 +674,8 @@ namespace Test { namespace Branch {
             case 10: bvba = BOOL_VAR_ACTION_MAX(baa); break;
             case 11: bvba = BOOL_VAR_CHB_MIN(bca); break;
             case 12: bvba = BOOL_VAR_CHB_MAX(bca); break;
+            case 13: bvba = BOOL_VAR_LAST_CONFLICT(bfa); break;
+            case 14: bvba = BOOL_VAR_CONFLICT_ORDER(); break;
             }
 
             Rnd rb(2);
@@ -680,6 +696,8 @@ namespace Test { namespace Branch {
             case 10: bvbb = BOOL_VAR_ACTION_MAX(bab,&tbl); break;
             case 11: bvbb = BOOL_VAR_CHB_MIN(bcb,&tbl); break;
             case 12: bvbb = BOOL_VAR_CHB_MAX(bcb,&tbl); break;
+            case 13: bvbb = BOOL_VAR_LAST_CONFLICT(1,&tbl); break;
+            case 14: bvbb = BOOL_VAR_CONFLICT_ORDER(&tbl); break;
             }
 
             switch (Base::rand(9U)) {
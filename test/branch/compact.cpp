@@ -0,0 +1,155 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test/branch.hh"
+#include "test/branch.hh"
+
+#include <gecode/search.hh>
+
+namespace Test { namespace Branch {
+
+  /**
+   * \brief %Test for branchers maintaining unassigned views
+   *
+   * Compares the solutions and search trees obtained by a brancher
+   * for a large array (which maintains the unassigned views) with
+   * those obtained by branchers for consecutive small parts of the
+   * array (which scan the views).
+   *
+   */
+  class Compact : public Base {
+  protected:
+    /// Size of the small parts
+    static const int m = Gecode::Kernel::Config::view_compact_limit / 2;
+    /// Number of variables
+    static const int n = 4*m;
+    /// How many solutions to compare
+    static const int n_sol = 16;
+    /// %Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Variables to branch on
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,n,-2,6) {}
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Gecode::Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// Whether to use a branch filter function
+    bool filter;
+    /// Post brancher for \a x
+    void branch(Gecode::Space& home, const Gecode::IntVarArgs& x) const {
+      using namespace Gecode;
+      if (filter)
+        Gecode::branch(home, x, INT_VAR_NONE(), INT_VAL_SPLIT_MIN(),
+                       [](const Space&, IntVar, int i) {
+                         return (i % 2) == 0;
+                       });
+      else
+        Gecode::branch(home, x, INT_VAR_NONE(), INT_VAL_SPLIT_MIN());
+    }
+    /// Create space with constraints and brancher on parts if \a parts
+    TestSpace* space(unsigned int seed, bool parts) const {
+      using namespace Gecode;
+      TestSpace* s = new TestSpace;
+      Support::RandomGenerator r(seed);
+      for (int i=0; i<n; i++) {
+        int l = static_cast<int>(r(5)) - 2;
+        int u = l + static_cast<int>(r(5));
+        dom(*s, s->x[i], l, u);
+        if (r(3) == 0)
+          rel(*s, s->x[i], IRT_NQ, l + static_cast<int>(r(3)));
+      }
+      for (int i=0; i+1<n; i++)
+        if (r(2) == 0)
+          rel(*s, s->x[i], IRT_NQ, s->x[i+1]);
+        else if (r(2) == 0)
+          rel(*s, s->x[i], IRT_LQ, s->x[static_cast<int>(r(n))]);
+      IntVarArgs x(s->x);
+      if (parts) {
+        for (int i=0; i<n; i += m)
+          branch(*s, x.slice(i,1,m));
+      } else {
+        branch(*s, x);
+      }
+      if (filter)
+        Gecode::branch(*s, s->x, INT_VAR_NONE(), INT_VAL_MIN());
+      return s;
+    }
+  public:
+    /// Create and register test
+    Compact(bool f)
+      : Base(std::string("Branch::Compact")+(f ? "::Filter" : "")),
+        filter(f) {}
+    /// Perform test
+    virtual bool run(void) {
+      using namespace Gecode;
+      unsigned int seed = rand(1U << 30);
+      TestSpace* a = space(seed,false);
+      TestSpace* p = space(seed,true);
+      Search::Options o;
+      o.c_d = 1 + rand(4);
+      DFS<TestSpace> e_a(a,o);
+      DFS<TestSpace> e_p(p,o);
+      delete a; delete p;
+      for (int k=0; k<n_sol; k++) {
+        TestSpace* s_a = e_a.next();
+        TestSpace* s_p = e_p.next();
+        if ((s_a == NULL) || (s_p == NULL)) {
+          bool same = (s_a == NULL) && (s_p == NULL);
+          delete s_a; delete s_p;
+          return same;
+        }
+        for (int i=0; i<n; i++)
+          if (s_a->x[i].val() != s_p->x[i].val()) {
+            delete s_a; delete s_p;
+            return false;
+          }
+        delete s_a; delete s_p;
+      }
+      return (e_a.statistics().node == e_p.statistics().node) &&
+        (e_a.statistics().fail == e_p.statistics().fail);
+    }
+  };
+
+  Compact c_none(false), c_filter(true);
+
+}}
+
+// STATISTICS: test-branch
@@ -0,0 +1,163 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test/branch.hh"
+
+#include <gecode/search.hh>
+
+namespace Test { namespace Branch {
+
+  /**
+   * \brief %Test for heap-based view selection
+   *
+   * Compares the solutions and search trees obtained with heap-based
+   * view selection with those obtained by scanning all views. Scanning
+   * is enforced by passing a tie-break limit function which is ignored
+   * for a single view selection.
+   *
+   */
+  class Heap : public Base {
+  protected:
+    /// Number of variables
+    static const int n = 3*Gecode::Kernel::Config::view_sel_heap_limit;
+    /// How many solutions to compare
+    static const int n_sol = 16;
+    /// %Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Variables to branch on
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,n,-2,6) {}
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Gecode::Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// Which variable selection to test
+    int sel;
+    /// Whether to use tie-breaking
+    bool tb;
+    /// Return variable selection, with tie-break limit function if \a tbl
+    Gecode::IntVarBranch vars(int s, bool tbl) const {
+      using namespace Gecode;
+      BranchTbl t = nullptr;
+      if (tbl)
+        t = [](const Space&, double, double b) { return b; };
+      switch (s) {
+      case 0: return INT_VAR_SIZE_MIN(t);
+      case 1: return INT_VAR_SIZE_MAX(t);
+      case 2: return INT_VAR_MIN_MIN(t);
+      case 3: return INT_VAR_MAX_MAX(t);
+      case 4: return INT_VAR_REGRET_MIN_MIN(t);
+      case 5: return INT_VAR_REGRET_MAX_MAX(t);
+      default: GECODE_NEVER;
+      }
+      return INT_VAR_NONE();
+    }
+    /// Create space with constraints and brancher
+    TestSpace* space(unsigned int seed, bool tbl) const {
+      using namespace Gecode;
+      TestSpace* s = new TestSpace;
+      Support::RandomGenerator r(seed);
+      for (int i=0; i<n; i++) {
+        int l = static_cast<int>(r(5)) - 2;
+        int u = l + static_cast<int>(r(5));
+        dom(*s, s->x[i], l, u);
+        if (r(3) == 0)
+          rel(*s, s->x[i], IRT_NQ, l + static_cast<int>(r(3)));
+      }
+      for (int i=0; i+1<n; i++)
+        if (r(2) == 0)
+          rel(*s, s->x[i], IRT_NQ, s->x[i+1]);
+        else if (r(2) == 0)
+          rel(*s, s->x[i], IRT_LQ, s->x[static_cast<int>(r(n))]);
+      if (tb)
+        branch(*s, s->x, tiebreak(vars(sel,tbl),vars((sel+1) % 6,tbl)),
+               INT_VAL_SPLIT_MIN());
+      else
+        branch(*s, s->x, vars(sel,tbl), INT_VAL_SPLIT_MIN());
+      return s;
+    }
+  public:
+    /// Create and register test
+    Heap(const std::string& s, int v, bool t)
+      : Base("Branch::Heap::"+s+(t ? "::TieBreak" : "")),
+        sel(v), tb(t) {}
+    /// Perform test
+    virtual bool run(void) {
+      using namespace Gecode;
+      unsigned int seed = rand(1U << 30);
+      TestSpace* h = space(seed,false);
+      TestSpace* c = space(seed,true);
+      Search::Options o;
+      o.c_d = 1 + rand(4);
+      DFS<TestSpace> e_h(h,o);
+      DFS<TestSpace> e_c(c,o);
+      delete h; delete c;
+      for (int k=0; k<n_sol; k++) {
+        TestSpace* s_h = e_h.next();
+        TestSpace* s_c = e_c.next();
+        if ((s_h == NULL) || (s_c == NULL)) {
+          bool same = (s_h == NULL) && (s_c == NULL);
+          delete s_h; delete s_c;
+          return same;
+        }
+        for (int i=0; i<n; i++)
+          if (s_h->x[i].val() != s_c->x[i].val()) {
+            delete s_h; delete s_c;
+            return false;
+          }
+        delete s_h; delete s_c;
+      }
+      return (e_h.statistics().node == e_c.statistics().node) &&
+        (e_h.statistics().fail == e_c.statistics().fail);
+    }
+  };
+
+  Heap h_size_min("Size::Min",0,false), h_size_max("Size::Max",1,false);
+  Heap h_min_min("Min::Min",2,false), h_max_max("Max::Max",3,false);
+  Heap h_regret_min("RegretMin::Min",4,false);
+  Heap h_regret_max("RegretMax::Max",5,false);
+  Heap ht_size_min("Size::Min",0,true), ht_size_max("Size::Max",1,true);
+  Heap ht_min_min("Min::Min",2,true), ht_max_max("Max::Max",3,true);
+  Heap ht_regret_min("RegretMin::Min",4,true);
+  Heap ht_regret_max("RegretMax::Max",5,true);
+
+}}
+
+// STATISTICS: test-branch
@@ -0,0 +1,157 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "test/branch.hh"
+
+#include <gecode/search.hh>
+
+namespace Test { namespace Branch {
+
+  /**
+   * \brief %Test for lookahead brancher
+   *
+   * Checks that a lookahead brancher followed by a regular brancher
+   * finds the same number of solutions as the regular brancher alone.
+   *
+   */
+  template<class VarArray>
+  class Lookahead : public Base {
+  protected:
+    /// Number of variables
+    static const int n = 6;
+    /// %Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Variables to branch on
+      VarArray x;
+      /// Constructor for creation
+      TestSpace(void);
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Gecode::Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+    /// Number of threads for probing
+    unsigned int threads;
+    /// Create space, with lookahead if \a la
+    TestSpace* space(unsigned int seed, bool la) const;
+  public:
+    /// Create and register test
+    Lookahead(const std::string& s, unsigned int t)
+      : Base("Branch::Lookahead::"+s), threads(t) {}
+    /// Perform test
+    virtual bool run(void) {
+      using namespace Gecode;
+      unsigned int seed = rand(1U << 30);
+      TestSpace* a = space(seed,false);
+      TestSpace* l = space(seed,true);
+      Search::Options o;
+      o.c_d = 1 + rand(4);
+      DFS<TestSpace> e_a(a,o);
+      DFS<TestSpace> e_l(l,o);
+      delete a; delete l;
+      int n_a = 0, n_l = 0;
+      while (TestSpace* s = e_a.next()) {
+        n_a++; delete s;
+      }
+      while (TestSpace* s = e_l.next()) {
+        for (int i=0; i<n; i++)
+          if (!s->x[i].assigned()) {
+            delete s;
+            return false;
+          }
+        n_l++; delete s;
+      }
+      return n_a == n_l;
+    }
+  };
+
+  template<>
+  Lookahead<Gecode::IntVarArray>::TestSpace::TestSpace(void)
+    : x(*this,n,0,4) {}
+
+  template<>
+  Lookahead<Gecode::BoolVarArray>::TestSpace::TestSpace(void)
+    : x(*this,n,0,1) {}
+
+  template<>
+  Lookahead<Gecode::IntVarArray>::TestSpace*
+  Lookahead<Gecode::IntVarArray>::space(unsigned int seed, bool la) const {
+    using namespace Gecode;
+    TestSpace* s = new TestSpace;
+    Support::RandomGenerator r(seed);
+    for (int i=0; i<n; i++)
+      for (int j=i+1; j<n; j++)
+        if (r(3) == 0)
+          rel(*s, s->x[i], IRT_NQ, s->x[j]);
+        else if (r(4) == 0)
+          rel(*s, s->x[i], IRT_LE, s->x[j]);
+    IntArgs c(n);
+    for (int i=0; i<n; i++)
+      c[i] = static_cast<int>(r(3)) + 1;
+    linear(*s, c, s->x, IRT_LQ, static_cast<int>(r(20)) + 5);
+    if (la)
+      lookahead(*s, s->x, 1 + r(3), threads);
+    branch(*s, s->x, INT_VAR_NONE(), INT_VAL_MIN());
+    return s;
+  }
+
+  template<>
+  Lookahead<Gecode::BoolVarArray>::TestSpace*
+  Lookahead<Gecode::BoolVarArray>::space(unsigned int seed, bool la) const {
+    using namespace Gecode;
+    TestSpace* s = new TestSpace;
+    Support::RandomGenerator r(seed);
+    for (int i=0; i+2<n; i++)
+      if (r(2) == 0)
+        rel(*s, s->x[i], BOT_OR, s->x[i+1], s->x[i+2]);
+      else
+        rel(*s, s->x[i], BOT_XOR, s->x[i+2], 1);
+    linear(*s, s->x, IRT_GQ, static_cast<int>(r(n)));
+    if (la)
+      lookahead(*s, s->x, 1 + r(3), threads);
+    branch(*s, s->x, BOOL_VAR_NONE(), BOOL_VAL_MIN());
+    return s;
+  }
+
+  Lookahead<Gecode::IntVarArray>
+    l_int_1("Int::1",1), l_int_2("Int::2",2);
+  Lookahead<Gecode::BoolVarArray>
+    l_bool_1("Bool::1",1), l_bool_2("Bool::2",2);
+
+}}
+
+// STATISTICS: test-branch
@@ -54,10 +54,12 @@ namespace Test {
       std::string _source;
       std::string _expected;
       bool _allSolutions;
+      unsigned int _threads;
     public:
-      /// Construct and register test
+      /// Construct and register test (preparing constraints with \a threads threads)
       FlatZincTest(const std::string& name, const std::string& source,
-                   const std::string& expected, bool allSolutions = false);
+                   const std::string& expected, bool allSolutions = false,
+                   unsigned int threads = 1U);
       /// Perform test
       virtual bool run(void);
     };
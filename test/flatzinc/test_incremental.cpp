@@ -0,0 +1,100 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "test/flatzinc.hh"
+
+#include <sstream>
+
+namespace Test { namespace FlatZinc {
+
+  namespace {
+    /// Test for posting constraints on a root space that has been solved
+    class Incremental : public Base {
+    public:
+      /// Create and register test
+      Incremental(void) : Base("FlatZinc::incremental") {}
+      /// Perform test
+      virtual bool run(void) {
+        using namespace Gecode;
+        using namespace Gecode::FlatZinc;
+        Support::Timer t_total;
+        t_total.start();
+        FlatZincOptions fznopt("Gecode/FlatZinc");
+        Printer p;
+        std::stringstream ss("var 1..3: x :: output_var;\n"
+                             "var 1..3: y :: output_var;\n"
+                             "constraint int_lt(x, y);\n"
+                             "solve satisfy;\n");
+        FlatZincSpace* fg = NULL;
+        try {
+          fg = parse(ss, p, olog);
+          if (fg == NULL)
+            return false;
+          fg->createBranchers(p, fg->solveAnnotations(), fznopt,
+                              false, olog);
+          std::ostringstream os0;
+          fg->run(os0, p, fznopt, t_total);
+          // Exclude the first solution and solve again
+          AST::Node* x = p.lookup("x");
+          if ((x == NULL) || (p.lookup("z") != NULL)) {
+            delete x;
+            delete fg;
+            return false;
+          }
+          AST::Array* args = new AST::Array(2);
+          args->a[0] = x;
+          args->a[1] = new AST::IntLit(1);
+          ConExpr ce("int_ne", args, NULL);
+          fg->postConstraint(ce);
+          std::ostringstream os1;
+          fg->run(os1, p, fznopt, t_total);
+          delete fg;
+          if (opt.log)
+            olog << "FlatZinc produced the following output:\n"
+                 << os0.str() << os1.str() << "\n";
+          return (os0.str() == "x = 1;\ny = 2;\n----------\n") &&
+            (os1.str() == "x = 2;\ny = 3;\n----------\n");
+        } catch (Gecode::FlatZinc::Error& e) {
+          if (opt.log)
+            olog << ind(2) << "FlatZinc error : " << e.toString() << std::endl;
+          delete fg;
+          return false;
+        }
+      }
+    };
+
+    Incremental incremental;
+  }
+
+}}
+
+// STATISTICS: test-flatzinc
@@ -0,0 +1,85 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include "test/flatzinc.hh"
+
+namespace Test { namespace FlatZinc {
+
+  namespace {
+    /// Helper class to create and register tests
+    class Create {
+    public:
+
+      /// Perform creation and registration
+      Create(void) {
+        (void) new FlatZincTest("test_on_restart",
+"var 1..5: x :: output_var;\n\
+var 1..5: xs;\n\
+var 1..5: st;\n\
+var 1..5: u :: output_var;\n\
+var bool: b;\n\
+constraint status(st);\n\
+constraint int_sol(x, xs);\n\
+constraint int_uniform(3, 3, u);\n\
+constraint int_eq_reif(st, 4, b);\n\
+constraint int_le_imp(xs, x, b);\n\
+\n\
+solve\n\
+	:: seq_search([int_search([x], input_order, indomain_min, complete),\n\
+	               restart_constant(5)])\n\
+	maximize x;\n\
+",
+"u = 3;\n\
+x = 1;\n\
+----------\n\
+u = 3;\n\
+x = 2;\n\
+----------\n\
+u = 3;\n\
+x = 3;\n\
+----------\n\
+u = 3;\n\
+x = 4;\n\
+----------\n\
+u = 3;\n\
+x = 5;\n\
+----------\n\
+==========\n\
+", true);
+      }
+    };
+
+    Create c;
+  }
+
+}}
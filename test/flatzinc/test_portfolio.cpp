@@ -0,0 +1,99 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "test/flatzinc.hh"
+
+#include <sstream>
+
+namespace Test { namespace FlatZinc {
+
+  namespace {
+    /// Test for solving with a portfolio of search strategies
+    class Portfolio : public Base {
+    protected:
+      /// Number of assets
+      unsigned int assets;
+    public:
+      /// Create and register test \a s with \a n assets
+      Portfolio(const std::string& s, unsigned int n)
+        : Base("FlatZinc::portfolio::"+s), assets(n) {}
+      /// Perform test
+      virtual bool run(void) {
+        using namespace Gecode;
+        using namespace Gecode::FlatZinc;
+        Support::Timer t_total;
+        t_total.start();
+        FlatZincOptions fznopt("Gecode/FlatZinc");
+        fznopt.assets(assets);
+        Printer p;
+        std::stringstream ss("var 0..3: a :: output_var;\n"
+                             "var 0..3: b :: output_var;\n"
+                             "var 0..3: c :: output_var;\n"
+                             "var 0..3: d :: output_var;\n"
+                             "var 0..100: obj :: output_var;\n"
+                             "constraint int_lin_le([2,3,4,5],[a,b,c,d],14);\n"
+                             "constraint int_lin_eq([3,5,7,9,-1],"
+                             "[a,b,c,d,obj],0);\n"
+                             "solve :: int_search([a,b,c,d],input_order,"
+                             "indomain_min,complete) maximize obj;\n");
+        FlatZincSpace* fg = NULL;
+        try {
+          fg = parse(ss, p, olog);
+          if (fg == NULL)
+            return false;
+          fg->createBranchers(p, fg->solveAnnotations(), fznopt,
+                              false, olog);
+          std::ostringstream os;
+          fg->run(os, p, fznopt, t_total);
+          delete fg;
+          if (opt.log)
+            olog << "FlatZinc produced the following output:\n"
+                 << os.str() << "\n";
+          return os.str() ==
+            "a = 0;\nb = 0;\nc = 1;\nd = 2;\nobj = 25;\n"
+            "----------\n==========\n";
+        } catch (Gecode::FlatZinc::Error& e) {
+          if (opt.log)
+            olog << ind(2) << "FlatZinc error : " << e.toString() << std::endl;
+          delete fg;
+          return false;
+        }
+      }
+    };
+
+    Portfolio portfolio2("2",2U);
+    Portfolio portfolio5("5",5U);
+  }
+
+}}
+
+// STATISTICS: test-flatzinc
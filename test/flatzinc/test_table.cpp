@@ -0,0 +1,74 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+#include "test/flatzinc.hh"
+
+namespace Test { namespace FlatZinc {
+
+  namespace {
+    /// Source of table test
+    const char* table_source =
+      "array [1..3] of var bool: b :: output_array([1..3]);\n"
+      "var 1..3: x :: output_var;\n"
+      "var 1..3: y :: output_var;\n"
+      "var 1..3: z :: output_var;\n"
+      "constraint gecode_table_bool(b, [true, false, true, false, true, true]);\n"
+      "constraint gecode_table_int([x, y], [1, 2, 2, 3, 3, 1]);\n"
+      "constraint gecode_table_int([y, z], [1, 2, 2, 3, 3, 1]);\n"
+      "solve satisfy;\n";
+    /// Expected output of table test
+    const char* table_expected =
+      "b = array1d(1..3, [true, false, true]);\n"
+      "x = 3;\n"
+      "y = 1;\n"
+      "z = 2;\n"
+      "----------\n";
+
+    /// Helper class to create and register tests
+    class Create {
+    public:
+
+      /// Perform creation and registration
+      Create(void) {
+        (void) new FlatZincTest("test_table::1",
+                                table_source, table_expected, false, 1U);
+        (void) new FlatZincTest("test_table::2",
+                                table_source, table_expected, false, 2U);
+      }
+    };
+
+    Create c;
+  }
+
+}}
+
+// STATISTICS: test-flatzinc
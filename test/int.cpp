@@ -467,6 +467,56 @@ if (!(T)) {                                                     \
   Test::post(Gecode::Space&, Gecode::IntVarArray&,
              Gecode::Reify) {}
 
+  bool
+  Test::bench(std::ostream& os) {
+    using namespace Gecode;
+    // Domain of requested size, Boolean domains are kept
+    IntSet d = ((dom.min() >= 0) && (dom.max() <= 1)) ? dom :
+      IntSet(dom.min(),dom.min()+static_cast<int>(opt.size)-1);
+    TestSpace* root = new TestSpace(arity,d,this);
+    // Randomize domains by removing about a quarter of the values
+    if (d.size() > 2)
+      for (int i=0; i<arity; i++)
+        for (IntSetValues v(d); v(); ++v)
+          if (Base::rand(4) == 0)
+            Gecode::rel(*root,root->x[i],IRT_NQ,v.val());
+    root->post();
+    if (root->failed()) {
+      os << "(failed initially)";
+      delete root;
+      return true;
+    }
+    // Memory per copy
+    CloneStatistics cs;
+    root->profile(true);
+    delete root->clone(cs);
+    root->profile(false);
+    // Only propagation is timed, pruning is not
+    Support::Timer t;
+    double ms = 0.0;
+    unsigned long int propagate = 0;
+    for (unsigned int i=opt.bench; i--; ) {
+      TestSpace* s = static_cast<TestSpace*>(root->clone());
+      while (!s->assigned()) {
+        s->prune();
+        StatusStatistics ss;
+        t.start();
+        SpaceStatus st = s->status(ss);
+        ms += t.stop();
+        propagate += ss.propagate;
+        if (st == SS_FAILED)
+          break;
+      }
+      delete s;
+    }
+    delete root;
+    os << "ipl: " << str(ipl) << " propagate: " << propagate
+       << " ns/propagate: "
+       << (propagate > 0 ? (ms * 1000000.0) / propagate : 0.0)
+       << " bytes/copy: " << cs.bytes;
+    return true;
+  }
+
   bool
   Test::run(void) {
     using namespace Gecode;
@@ -305,6 +305,15 @@ namespace Test {
                         Gecode::Reify r);
       /// Perform test
       virtual bool run(void);
+      /**
+       * \brief Run microbenchmark
+       *
+       * Posts the constraint on variables with randomized domains
+       * of size \a opt.size (Boolean domains are kept) and drives it
+       * through \a opt.bench random prune sequences. Prints time per
+       * propagator execution and memory per copy to \a os.
+       */
+      virtual bool bench(std::ostream& os);
       /// \name Mapping scalar values to strings
       //@{
       /// Map integer propagation level to string
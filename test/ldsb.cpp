@@ -1304,6 +1304,163 @@ namespace Test { namespace LDSB {
     }
   };
 
+  /// %Test for dominance detection with variable symmetry
+  class SBDDVarSym1 {
+  public:
+    /// Number of variables
+    static const int n = 4;
+    /// Lower bound of values
+    static const int l = 0;
+    /// Upper bound of values
+    static const int u = 3;
+    /// Setup problem constraints and symmetries
+    static void setup(Home home, IntVarArray& xs) {
+      distinct(home, xs);
+      Symmetries syms;
+      syms << VariableSymmetry(xs);
+      sbdd(home, xs, INT_VAR_NONE(), INT_VAL_MIN(), syms);
+    }
+    /// Compute list of expected solutions
+    static std::vector<IntArgs> expectedSolutions(void) {
+      static std::vector<IntArgs> expected;
+      expected.clear();
+      expected.push_back(IntArgs({0,1,2,3}));
+      return expected;
+    }
+  };
+
+  /// %Test for dominance detection with variable symmetry
+  class SBDDVarSym2 {
+  public:
+    /// Number of variables
+    static const int n = 4;
+    /// Lower bound of values
+    static const int l = 0;
+    /// Upper bound of values
+    static const int u = 3;
+    /// Setup problem constraints and symmetries
+    static void setup(Home home, IntVarArray& xs) {
+      Symmetries syms;
+      syms << VariableSymmetry(xs);
+      sbdd(home, xs, INT_VAR_NONE(), INT_VAL_MIN(), syms);
+    }
+    /// Compute list of expected solutions
+    static std::vector<IntArgs> expectedSolutions(void) {
+      return VarSym2::expectedSolutions();
+    }
+  };
+
+  /// %Test for dominance detection with row interchange symmetry
+  class SBDDMatSym1 {
+  public:
+    /// Number of variables
+    static const int n = 6;
+    /// Lower bound of values
+    static const int l = 0;
+    /// Upper bound of values
+    static const int u = 1;
+    /// Setup problem constraints and symmetries
+    static void setup(Home home, IntVarArray& xs) {
+      Matrix<IntVarArray> m(xs, 2, 3);
+      Symmetries s;
+      s << rows_interchange(m);
+      sbdd(home, xs, INT_VAR_NONE(), INT_VAL_MIN(), s);
+    }
+    /// Compute list of expected solutions
+    static std::vector<IntArgs> expectedSolutions(void) {
+      static std::vector<IntArgs> expected;
+      expected.clear();
+      expected.push_back(IntArgs({0,0, 0,0, 0,0}));
+      expected.push_back(IntArgs({0,0, 0,0, 0,1}));
+      expected.push_back(IntArgs({0,0, 0,0, 1,0}));
+      expected.push_back(IntArgs({0,0, 0,0, 1,1}));
+      expected.push_back(IntArgs({0,0, 0,1, 0,1}));
+      expected.push_back(IntArgs({0,0, 0,1, 1,0}));
+      expected.push_back(IntArgs({0,0, 0,1, 1,1}));
+      expected.push_back(IntArgs({0,0, 1,0, 1,0}));
+      expected.push_back(IntArgs({0,0, 1,0, 1,1}));
+      expected.push_back(IntArgs({0,0, 1,1, 1,1}));
+      expected.push_back(IntArgs({0,1, 0,1, 0,1}));
+      expected.push_back(IntArgs({0,1, 0,1, 1,0}));
+      expected.push_back(IntArgs({0,1, 0,1, 1,1}));
+      expected.push_back(IntArgs({0,1, 1,0, 1,0}));
+      expected.push_back(IntArgs({0,1, 1,0, 1,1}));
+      expected.push_back(IntArgs({0,1, 1,1, 1,1}));
+      expected.push_back(IntArgs({1,0, 1,0, 1,0}));
+      expected.push_back(IntArgs({1,0, 1,0, 1,1}));
+      expected.push_back(IntArgs({1,0, 1,1, 1,1}));
+      expected.push_back(IntArgs({1,1, 1,1, 1,1}));
+      return expected;
+    }
+  };
+
+  /// %Test for dominance detection with value symmetry
+  class SBDDValSym1 {
+  public:
+    /// Number of variables
+    static const int n = 4;
+    /// Lower bound of values
+    static const int l = 0;
+    /// Upper bound of values
+    static const int u = 2;
+    /// Setup problem constraints and symmetries
+    static void setup(Home home, IntVarArray& xs) {
+      Symmetries syms;
+      syms << ValueSymmetry(IntSet(0,2));
+      sbdd(home, xs, INT_VAR_NONE(), INT_VAL_MIN(), syms);
+    }
+    /// Compute list of expected solutions
+    static std::vector<IntArgs> expectedSolutions(void) {
+      static std::vector<IntArgs> expected;
+      expected.clear();
+      expected.push_back(IntArgs({0,0,0,0}));
+      expected.push_back(IntArgs({0,0,0,1}));
+      expected.push_back(IntArgs({0,0,1,0}));
+      expected.push_back(IntArgs({0,0,1,1}));
+      expected.push_back(IntArgs({0,0,1,2}));
+      expected.push_back(IntArgs({0,1,0,0}));
+      expected.push_back(IntArgs({0,1,0,1}));
+      expected.push_back(IntArgs({0,1,0,2}));
+      expected.push_back(IntArgs({0,1,1,0}));
+      expected.push_back(IntArgs({0,1,1,1}));
+      expected.push_back(IntArgs({0,1,1,2}));
+      expected.push_back(IntArgs({0,1,2,0}));
+      expected.push_back(IntArgs({0,1,2,1}));
+      expected.push_back(IntArgs({0,1,2,2}));
+      return expected;
+    }
+  };
+
+  /// %Test for dominance detection with Boolean variable symmetry
+  class SBDDBoolVarSym1 {
+  public:
+    /// Number of variables
+    static const int n = 3;
+    /// Lower bound of values
+    static const int l = 0;
+    /// Upper bound of values
+    static const int u = 1;
+    /// Setup problem constraints and symmetries
+    static void setup(Home home, IntVarArray& xs) {
+      BoolVarArgs bs;
+      for (int i=0; i<xs.size(); i++)
+        bs << channel(home, xs[i]);
+      Symmetries syms;
+      syms << VariableSymmetry(bs);
+      sbdd(home, bs, BOOL_VAR_NONE(), BOOL_VAL_MIN(), syms);
+    }
+    /// Compute list of expected solutions
+    static std::vector<IntArgs> expectedSolutions(void) {
+      static std::vector<IntArgs> expected;
+      expected.clear();
+      expected.push_back(IntArgs({0,0,0}));
+      expected.push_back(IntArgs({0,0,1}));
+      expected.push_back(IntArgs({0,1,1}));
+      expected.push_back(IntArgs({1,1,1}));
+      return expected;
+    }
+  };
+
 #ifdef GECODE_HAS_SET_VARS
   /// Convenient way to make IntSetArgs
   IntSetArgs ISA(int n, ...) {
@@ -1613,6 +1770,39 @@ namespace Test { namespace LDSB {
     }
   };
 
+  /// %Test for dominance detection with set variable symmetry
+  class SBDDSetVarSym1 {
+  public:
+    /// Number of variables
+    static const int n = 2;
+    /// Lower bound of values
+    static const int l = 0;
+    /// Upper bound of values
+    static const int u = 1;
+    /// Setup problem constraints and symmetries
+    static void setup(Home home, SetVarArray& xs) {
+      Symmetries syms;
+      syms << VariableSymmetry(xs);
+      sbdd(home, xs, SET_VAR_NONE(), SET_VAL_MIN_INC(), syms);
+    }
+    /// Compute list of expected solutions
+    static std::vector<IntSetArgs> expectedSolutions(void) {
+      static std::vector<IntSetArgs> expected;
+      expected.clear();
+      expected.push_back(ISA(2, 0,1,-1, 0,1,-1));
+      expected.push_back(ISA(2, 0,1,-1, 0,  -1));
+      expected.push_back(ISA(2, 0,1,-1,   1,-1));
+      expected.push_back(ISA(2, 0,1,-1,     -1));
+      expected.push_back(ISA(2, 0,  -1, 0,  -1));
+      expected.push_back(ISA(2, 0,  -1,   1,-1));
+      expected.push_back(ISA(2, 0,  -1,     -1));
+      expected.push_back(ISA(2,   1,-1,   1,-1));
+      expected.push_back(ISA(2,   1,-1,     -1));
+      expected.push_back(ISA(2,     -1,     -1));
+      return expected;
+    }
+  };
+
 #endif
 
   LDSB<VarSym1> varsym1("VarSym1");
@@ -1642,6 +1832,12 @@ namespace Test { namespace LDSB {
   LDSBLatin latin("Latin");
   LDSB<Recomputation> recomp("Recomputation", 999,999);
   LDSB<TieBreak> tiebreak("TieBreak");
+  LDSB<SBDDVarSym1> sbddvarsym1("SBDD::VarSym1");
+  LDSB<SBDDVarSym2> sbddvarsym2("SBDD::VarSym2");
+  LDSB<SBDDMatSym1> sbddmatsym1("SBDD::MatSym1");
+  LDSB<SBDDMatSym1> sbddmatsym1r("SBDD::MatSym1::Recomputation", 3, 2);
+  LDSB<SBDDValSym1> sbddvalsym1("SBDD::ValSym1");
+  LDSB<SBDDBoolVarSym1> sbddboolvarsym1("SBDD::BoolVarSym1");
 
 #ifdef GECODE_HAS_SET_VARS
   LDSB<ReflectSym1> reflectsym1("ReflectSym1");
@@ -1653,6 +1849,7 @@ namespace Test { namespace LDSB {
   LDSBSet<SetValSym2> setvalsym2("SetValSym2", 0, 1);
   LDSBSet<SetVarSeqSym1> setvarseqsym1("SetVarSeqSym1");
   LDSBSet<SetVarSeqSym2> setvarseqsym2("SetVarSeqSym2");
+  LDSBSet<SBDDSetVarSym1> sbddsetvarsym1("SBDD::SetVarSym1");
 #endif
 }}
 
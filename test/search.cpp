@@ -36,6 +36,8 @@
 
 #include "test/test.hh"
 
+#include <sstream>
+
 namespace Test {
 
   /// Tests for search engines
@@ -397,6 +399,88 @@ namespace Test {
       }
     };
 
+    /// %Test for profiling depth-first search
+    template<class Model>
+    class Profile : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Profile(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+              unsigned int t0)
+        : Test("Profile::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        m->profile(true);
+        Gecode::Search::Options o;
+        o.threads = t;
+        Gecode::DFS<Model> dfs(m,o);
+        delete m;
+        while (Model* s = dfs.next())
+          delete s;
+        Gecode::Search::Statistics stat = dfs.statistics();
+        // All propagator executions must be profiled
+        unsigned long int n = 0;
+        for (int i=0; i<stat.profile.entries(); i++)
+          n += stat.profile[i].propagate;
+        return (stat.profile.entries() > 0) && (n == stat.propagate) &&
+          (stat.clone > 0) && (stat.bytes > 0) && (stat.commit > 0);
+      }
+    };
+
+    /// %Test for sampling
+    template<class Model>
+    class Sample : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Sample(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+             unsigned int t0)
+        : Test("Sample::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        // Sample every execution
+        Gecode::Sampler sampler(1);
+        Model* m = new Model(htb1,htb2,htb3);
+        m->sample(sampler);
+        Gecode::Search::Options o;
+        o.threads = t;
+        Gecode::DFS<Model> dfs(m,o);
+        delete m;
+        while (Model* s = dfs.next())
+          delete s;
+        Gecode::Search::Statistics stat = dfs.statistics();
+        std::ostringstream os;
+        sampler.dump(os);
+        // All propagator executions must be sampled
+        std::istringstream is(os.str());
+        std::string l;
+        unsigned long int p = 0, c = 0;
+        while (std::getline(is,l)) {
+          // The count follows the last space
+          std::string::size_type s = l.rfind(' ');
+          if (s == std::string::npos)
+            return false;
+          unsigned long int n = std::stoul(l.substr(s+1));
+          if (l.compare(0,10,"propagate;") == 0)
+            p += n;
+          else if (l.compare(0,7,"commit;") == 0)
+            c += n;
+          else
+            return false;
+        }
+        return (p == stat.propagate) && (c > 0);
+      }
+    };
+
     /// %Test for limited discrepancy search
     template<class Model>
     class LDS : public Test {
@@ -723,6 +807,20 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Profiling
+        for (unsigned int t = 1; t<=4; t++) {
+          (void) new Profile<HasSolutions>(HTB_BINARY, HTB_BINARY, HTB_BINARY,
+                                           t);
+          (void) new Profile<HasSolutions>(HTB_NARY, HTB_NARY, HTB_NARY, t);
+        }
+
+        // Sampling
+        for (unsigned int t = 1; t<=4; t++) {
+          (void) new Sample<HasSolutions>(HTB_BINARY, HTB_BINARY, HTB_BINARY,
+                                          t);
+          (void) new Sample<HasSolutions>(HTB_NARY, HTB_NARY, HTB_NARY, t);
+        }
+
         // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++) {
           for (BranchTypes htb1; htb1(); ++htb1)
@@ -89,6 +89,11 @@ namespace Test {
     Gecode::heap.free(b,_n_tests);
   }
 
+  bool
+  Base::bench(std::ostream&) {
+    return false;
+  }
+
   Base::~Base(void) {}
 
   Gecode::Support::RandomGenerator Base::rand
@@ -155,6 +160,12 @@ namespace Test {
                   << "\t\tstop on first error or continue" << std::endl
                   << "\t-list" << std::endl
                   << "\t\toutput list of all test cases and exit" << std::endl
+                  << "\t-bench (unsigned int) default: " << bench << std::endl
+                  << "\t\tnumber of random prune sequences per test" << std::endl
+                  << "\t\tfor microbenchmarking propagators instead of testing"
+                  << std::endl
+                  << "\t-size (unsigned int) default: " << size << std::endl
+                  << "\t\tdomain size for microbenchmarks" << std::endl
           ;
         exit(EXIT_SUCCESS);
       } else if (!strcmp(argv[i],"-seed")) {
@@ -192,6 +203,12 @@ namespace Test {
         }
       } else if (!strcmp(argv[i],"-list")) {
         list = true;
+      } else if (!strcmp(argv[i],"-bench")) {
+        if (++i == argc) goto missing;
+        bench = static_cast<unsigned int>(atoi(argv[i]));
+      } else if (!strcmp(argv[i],"-size")) {
+        if (++i == argc) goto missing;
+        size = static_cast<unsigned int>(atoi(argv[i]));
       }
       i++;
     }
@@ -254,6 +271,12 @@ main(int argc, char* argv[]) {
       }
       std::cout << t->name() << " ";
       std::cout.flush();
+      if (opt.bench > 0) {
+        if (!t->bench(std::cout))
+          std::cout << "(no benchmark)";
+        std::cout << std::endl;
+        goto next;
+      }
       for (unsigned int i = opt.iter; i--; ) {
         opt.seed = Base::rand.seed();
         if (t->run()) {
@@ -89,6 +89,12 @@ namespace Test {
     bool stop;
     /// Whether to log the tests
     bool log;
+    /// Number of prune sequences for microbenchmarks (zero for testing)
+    unsigned int bench;
+    /// Domain size for microbenchmarks
+    unsigned int size;
+    /// Default domain size for microbenchmarks
+    static const unsigned int defsize = 64;
 
     /// Initialize options with defaults
     Options(void);
@@ -125,6 +131,8 @@ namespace Test {
     void next(Base* n);
     /// Run test
     virtual bool run(void) = 0;
+    /// Run microbenchmark and print results to \a os (false if unsupported)
+    virtual bool bench(std::ostream& os);
     /// Throw a coin whether to compute a fixpoint
     static bool fixpoint(void);
     /// Destructor
@@ -0,0 +1,566 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/support.hh>
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define GECODE_BENCH_FORK
+#endif
+
+/**
+ * \brief Benchmark runner
+ *
+ * Runs a curated set of example scripts and generated FlatZinc
+ * instances with fixed seeds, records their performance as JSON,
+ * and compares it against a baseline.
+ */
+namespace Bench {
+
+  /// Description of a benchmark
+  class Benchmark {
+  public:
+    /// Name of the benchmark
+    std::string name;
+    /// Name of the example (empty for FlatZinc instances)
+    std::string exe;
+    /// Arguments for the executable (the FlatZinc file is appended)
+    std::string args;
+    /// Generator for FlatZinc instance (NULL for examples)
+    void (*fzn)(std::ostream&);
+  };
+
+  /// Result of running a benchmark
+  class Result {
+  public:
+    /// Name of the benchmark
+    std::string name;
+    /// Whether the benchmark could be run
+    bool ok;
+    /// Wall-clock time in milliseconds (best of all runs)
+    double wall;
+    /// Number of nodes
+    unsigned long int nodes;
+    /// Number of propagator executions
+    unsigned long int propagations;
+    /// Memory used for clones in bytes
+    unsigned long int clone;
+    /// Peak resident memory in kilobytes (zero if unknown)
+    unsigned long int peak;
+    /// Initialize empty result for benchmark \a n
+    Result(const std::string& n)
+      : name(n), ok(false), wall(0.0), nodes(0), propagations(0),
+        clone(0), peak(0) {}
+    /// Nodes per second
+    double nps(void) const {
+      return (wall > 0.0) ? nodes * 1000.0 / wall : 0.0;
+    }
+    /// Propagations per second
+    double pps(void) const {
+      return (wall > 0.0) ? propagations * 1000.0 / wall : 0.0;
+    }
+  };
+
+
+  /*
+   * Generated FlatZinc instances
+   *
+   */
+
+  /// Random knapsack problem with 22 items
+  void
+  knapsack(std::ostream& os) {
+    Gecode::Support::RandomGenerator r(1);
+    const int n = 22;
+    std::vector<int> w(n), p(n);
+    int c = 0;
+    for (int i=0; i<n; i++) {
+      w[i] = 10 + static_cast<int>(r(90));
+      p[i] = w[i] + static_cast<int>(r(20));
+      c += w[i];
+    }
+    os << "array [1.." << n << "] of var 0..1: x :: output_array([1.."
+       << n << "]);" << std::endl
+       << "var 0.." << 2*c << ": profit :: output_var;" << std::endl;
+    os << "constraint int_lin_le([";
+    for (int i=0; i<n; i++)
+      os << (i ? "," : "") << w[i];
+    os << "],x," << c/3 << ");" << std::endl;
+    os << "constraint int_lin_eq([";
+    for (int i=0; i<n; i++)
+      os << p[i] << ",";
+    os << "-1],[";
+    for (int i=0; i<n; i++)
+      os << "x[" << i+1 << "],";
+    os << "profit],0);" << std::endl
+       << "solve :: int_search(x,input_order,indomain_max,complete) "
+       << "maximize profit;" << std::endl;
+  }
+
+  /// Coloring of a random graph with 45 nodes
+  void
+  coloring(std::ostream& os) {
+    Gecode::Support::RandomGenerator r(2);
+    const int n = 45;
+    os << "array [1.." << n << "] of var 1.." << n
+       << ": c :: output_array([1.." << n << "]);" << std::endl
+       << "var 1.." << n << ": k :: output_var;" << std::endl;
+    for (int i=1; i<=n; i++)
+      for (int j=i+1; j<=n; j++)
+        if (r(100) < 25)
+          os << "constraint int_ne(c[" << i << "],c[" << j << "]);"
+             << std::endl;
+    for (int i=1; i<=n; i++)
+      os << "constraint int_le(c[" << i << "],k);" << std::endl;
+    os << "solve :: int_search(c,first_fail,indomain_min,complete) "
+       << "minimize k;" << std::endl;
+  }
+
+  /// Random job-shop scheduling problem with 5 jobs and 5 machines
+  void
+  jobshop(std::ostream& os) {
+    Gecode::Support::RandomGenerator r(3);
+    const int n = 5, m = 5;
+    std::vector<int> d(n*m), mc(n*m);
+    int h = 0;
+    for (int j=0; j<n; j++) {
+      // Random order of machines for each job
+      std::vector<int> o(m);
+      for (int k=0; k<m; k++)
+        o[k] = k;
+      for (int k=m-1; k>0; k--)
+        std::swap(o[k],o[r(static_cast<unsigned int>(k+1))]);
+      for (int k=0; k<m; k++) {
+        d[j*m+k] = 1 + static_cast<int>(r(9));
+        mc[j*m+k] = o[k];
+        h += d[j*m+k];
+      }
+    }
+    os << "array [1.." << n*m << "] of var 0.." << h
+       << ": s :: output_array([1.." << n*m << "]);" << std::endl
+       << "var 0.." << h << ": makespan :: output_var;" << std::endl;
+    int b = 0;
+    for (int t=0; t<n*m; t++)
+      for (int u=t+1; u<n*m; u++)
+        if (mc[t] == mc[u]) {
+          os << "var bool: b" << b << ";" << std::endl
+             << "var bool: b" << b+1 << ";" << std::endl;
+          b += 2;
+        }
+    for (int j=0; j<n; j++)
+      for (int k=0; k+1<m; k++)
+        os << "constraint int_lin_le([1,-1],[s[" << j*m+k+1 << "],s["
+           << j*m+k+2 << "]]," << -d[j*m+k] << ");" << std::endl;
+    b = 0;
+    for (int t=0; t<n*m; t++)
+      for (int u=t+1; u<n*m; u++)
+        if (mc[t] == mc[u]) {
+          os << "constraint int_lin_le_reif([1,-1],[s[" << t+1 << "],s["
+             << u+1 << "]]," << -d[t] << ",b" << b << ");" << std::endl
+             << "constraint int_lin_le_reif([1,-1],[s[" << u+1 << "],s["
+             << t+1 << "]]," << -d[u] << ",b" << b+1 << ");" << std::endl
+             << "constraint bool_clause([b" << b << ",b" << b+1
+             << "],[]);" << std::endl;
+          b += 2;
+        }
+    for (int t=0; t<n*m; t++)
+      os << "constraint int_lin_le([1,-1],[s[" << t+1 << "],makespan],"
+         << -d[t] << ");" << std::endl;
+    os << "solve :: int_search(s,smallest,indomain_min,complete) "
+       << "minimize makespan;" << std::endl;
+  }
+
+  /// The benchmarks
+  const Benchmark benchmarks[] = {
+    {"queens", "queens", "-solutions 0 12", NULL},
+    {"golomb-ruler", "golomb-ruler", "9", NULL},
+    {"job-shop", "job-shop", "ft06", NULL},
+    {"sudoku", "sudoku", "-solutions 0 8", NULL},
+    {"bin-packing", "bin-packing", "", NULL},
+    {"alpha", "alpha", "-solutions 0", NULL},
+    {"fzn-knapsack", "", "", &knapsack},
+    {"fzn-coloring", "", "", &coloring},
+    {"fzn-jobshop", "", "", &jobshop}
+  };
+  /// Number of benchmarks
+  const int n_benchmarks = sizeof(benchmarks)/sizeof(Benchmark);
+
+
+  /*
+   * Running benchmarks
+   *
+   */
+
+  /// Run command \a c, store its output in \a out and its peak memory in \a peak
+  bool
+  execute(const std::string& c, std::string& out, unsigned long int& peak) {
+    out.clear(); peak = 0;
+#ifdef GECODE_BENCH_FORK
+    int fd[2];
+    if (pipe(fd) != 0)
+      return false;
+    pid_t pid = fork();
+    if (pid < 0)
+      return false;
+    if (pid == 0) {
+      close(fd[0]);
+      dup2(fd[1],1); dup2(fd[1],2);
+      close(fd[1]);
+      execl("/bin/sh","sh","-c",c.c_str(),static_cast<char*>(NULL));
+      _exit(127);
+    }
+    close(fd[1]);
+    char b[4096];
+    ssize_t n;
+    while ((n = read(fd[0],b,sizeof(b))) > 0)
+      out.append(b,static_cast<size_t>(n));
+    close(fd[0]);
+    int status;
+    struct rusage ru;
+    if (wait4(pid,&status,0,&ru) != pid)
+      return false;
+#ifdef __APPLE__
+    // Maximum resident set size is in bytes
+    peak = static_cast<unsigned long int>(ru.ru_maxrss) / 1024;
+#else
+    peak = static_cast<unsigned long int>(ru.ru_maxrss);
+#endif
+    return WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+#else
+    FILE* p = popen(c.c_str(),"r");
+    if (p == NULL)
+      return false;
+    char b[4096];
+    size_t n;
+    while ((n = fread(b,1,sizeof(b),p)) > 0)
+      out.append(b,n);
+    return pclose(p) == 0;
+#endif
+  }
+
+  /// Parse statistics of scripts and fzn-gecode from \a out into \a r
+  void
+  parse(const std::string& out, Result& r) {
+    std::istringstream is(out);
+    std::string l;
+    while (std::getline(is,l)) {
+      std::string::size_type s = l.find_first_not_of("% \t");
+      if (s == std::string::npos)
+        continue;
+      l = l.substr(s);
+      // Statistics of fzn-gecode are key=value pairs
+      std::string::size_type e = l.find_first_of(":=");
+      if (e == std::string::npos)
+        continue;
+      std::string k = l.substr(0,e);
+      if (k == "mzn-stat") {
+        l = l.substr(e+1);
+        l = l.substr(l.find_first_not_of(" "));
+        e = l.find('=');
+        if (e == std::string::npos)
+          continue;
+        k = l.substr(0,e);
+      }
+      unsigned long int v = strtoul(l.c_str()+e+1,NULL,10);
+      if (k == "propagations")
+        r.propagations = v;
+      else if (k == "nodes")
+        r.nodes = v;
+      else if (k == "clone memory")
+        r.clone = v * 1024;
+    }
+  }
+
+  /**
+   * \brief Run benchmark \a b \a n times
+   *
+   * Examples are taken from directory \a ex, FlatZinc instances are
+   * written to directory \a tmp and solved by \a fzn.
+   */
+  Result
+  run(const Benchmark& b, const std::string& ex, const std::string& fzn,
+      const std::string& tmp, int n) {
+    Result r(b.name);
+    std::string c;
+    if (b.fzn != NULL) {
+      std::string f = tmp + "/gecode-bench-" + b.name + ".fzn";
+      std::ofstream os(f.c_str());
+      b.fzn(os);
+      os.close();
+      c = fzn + " -s -r 1 -profile " + b.args + " " + f;
+    } else {
+      c = ex + "/" + b.exe + " -mode stat -seed 1 -profile true " + b.args;
+    }
+    for (int i=0; i<n; i++) {
+      std::string out;
+      unsigned long int peak;
+      Gecode::Support::Timer t;
+      t.start();
+      bool ok = execute(c,out,peak);
+      double w = t.stop();
+      if (!ok) {
+        r.ok = false;
+        return r;
+      }
+      if (!r.ok || (w < r.wall))
+        r.wall = w;
+      r.ok = true;
+      if (peak > r.peak)
+        r.peak = peak;
+      parse(out,r);
+    }
+    return r;
+  }
+
+
+  /*
+   * JSON input and output
+   *
+   */
+
+  /// Print results \a rs as JSON to \a os, one benchmark per line
+  void
+  json(std::ostream& os, const std::vector<Result>& rs) {
+    os << "{\"benchmarks\": [" << std::endl;
+    bool first = true;
+    for (const Result& r : rs) {
+      if (!r.ok)
+        continue;
+      if (!first)
+        os << "," << std::endl;
+      first = false;
+      os << std::fixed << std::setprecision(3)
+         << "  {\"name\": \"" << r.name << "\", "
+         << "\"wall_ms\": " << r.wall << ", "
+         << "\"nodes\": " << r.nodes << ", "
+         << "\"propagations\": " << r.propagations << ", "
+         << "\"nodes_per_sec\": " << r.nps() << ", "
+         << "\"propagations_per_sec\": " << r.pps() << ", "
+         << "\"clone_bytes\": " << r.clone << ", "
+         << "\"peak_memory_kb\": " << r.peak << "}";
+    }
+    os << std::endl << "]}" << std::endl;
+  }
+
+  /// Return value of field \a k in JSON object \a l (NULL if none)
+  const char*
+  field(const std::string& l, const char* k) {
+    std::string::size_type i = l.find(std::string("\"") + k + "\":");
+    if (i == std::string::npos)
+      return NULL;
+    i = l.find_first_not_of(" ",i+strlen(k)+3);
+    return (i == std::string::npos) ? NULL : l.c_str()+i;
+  }
+
+  /// Read baseline results from file \a f (as written by json)
+  bool
+  baseline(const char* f, std::vector<Result>& rs) {
+    std::ifstream is(f);
+    if (!is)
+      return false;
+    std::string l;
+    while (std::getline(is,l)) {
+      const char* n = field(l,"name");
+      const char* w = field(l,"wall_ms");
+      if ((n == NULL) || (w == NULL) || (*n != '"'))
+        continue;
+      Result r(std::string(n+1,strchr(n+1,'"')));
+      r.ok = true;
+      r.wall = strtod(w,NULL);
+      if (const char* v = field(l,"nodes"))
+        r.nodes = strtoul(v,NULL,10);
+      if (const char* v = field(l,"propagations"))
+        r.propagations = strtoul(v,NULL,10);
+      if (const char* v = field(l,"clone_bytes"))
+        r.clone = strtoul(v,NULL,10);
+      if (const char* v = field(l,"peak_memory_kb"))
+        r.peak = strtoul(v,NULL,10);
+      rs.push_back(r);
+    }
+    return true;
+  }
+
+}
+
+int
+main(int argc, char* argv[]) {
+  using namespace Bench;
+  using namespace std;
+  // Executables are by default next to the benchmark runner
+  string ex(argv[0]);
+  string::size_type s = ex.find_last_of("/\\");
+  ex = (s == string::npos) ? string(".") : ex.substr(0,s);
+  string fzn = ex + "/fzn-gecode";
+  string tmp(".");
+  const char* out = "gecode-bench.json";
+  const char* base = NULL;
+  double threshold = 10.0;
+  int runs = 3;
+  vector<string> pat;
+
+  for (int i=1; i<argc; i++) {
+    if (!strcmp(argv[i],"-help") || !strcmp(argv[i],"--help")) {
+      cerr << "Options for benchmarking:" << endl
+           << "\t-examples (string) default: " << ex << endl
+           << "\t\tdirectory containing the examples" << endl
+           << "\t-fzn (string) default: " << fzn << endl
+           << "\t\tFlatZinc interpreter" << endl
+           << "\t-tmp (string) default: " << tmp << endl
+           << "\t\tdirectory for generated FlatZinc instances" << endl
+           << "\t-out (string) default: " << out << endl
+           << "\t\tfile to write results as JSON to" << endl
+           << "\t-baseline (string) default: (none)" << endl
+           << "\t\tJSON file with results to compare against" << endl
+           << "\t-threshold (double) default: " << threshold << endl
+           << "\t\tslowdown in percent reported as regression" << endl
+           << "\t-runs (int) default: " << runs << endl
+           << "\t\tnumber of runs per benchmark (best time is used)" << endl
+           << "\t-test (string) default: (none)" << endl
+           << "\t\tsimple pattern for the benchmarks to run" << endl
+           << "\t-list" << endl
+           << "\t\toutput list of all benchmarks and exit" << endl;
+      return EXIT_SUCCESS;
+    } else if (!strcmp(argv[i],"-list")) {
+      for (int j=0; j<n_benchmarks; j++)
+        cout << benchmarks[j].name << endl;
+      return EXIT_SUCCESS;
+    } else if (i+1 == argc) {
+      cerr << "Erroneous argument (" << argv[i] << ")" << endl
+           << "  missing parameter" << endl;
+      return EXIT_FAILURE;
+    } else if (!strcmp(argv[i],"-examples")) {
+      ex = argv[++i];
+    } else if (!strcmp(argv[i],"-fzn")) {
+      fzn = argv[++i];
+    } else if (!strcmp(argv[i],"-tmp")) {
+      tmp = argv[++i];
+    } else if (!strcmp(argv[i],"-out")) {
+      out = argv[++i];
+    } else if (!strcmp(argv[i],"-baseline")) {
+      base = argv[++i];
+    } else if (!strcmp(argv[i],"-threshold")) {
+      threshold = atof(argv[++i]);
+    } else if (!strcmp(argv[i],"-runs")) {
+      runs = std::max(atoi(argv[++i]),1);
+    } else if (!strcmp(argv[i],"-test")) {
+      pat.push_back(argv[++i]);
+    } else {
+      cerr << "Unknown argument (" << argv[i] << ")" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  vector<Result> rs;
+  for (int i=0; i<n_benchmarks; i++) {
+    const Benchmark& b = benchmarks[i];
+    bool match = pat.empty();
+    for (const string& p : pat)
+      match |= (b.name.find(p) != string::npos);
+    if (!match)
+      continue;
+    cout << left << setw(16) << b.name;
+    cout.flush();
+    Result r = run(b,ex,fzn,tmp,runs);
+    if (r.ok)
+      cout << fixed << setprecision(3) << right
+           << setw(12) << r.wall << " ms"
+           << setw(14) << setprecision(0) << r.nps() << " nodes/s"
+           << setw(14) << r.pps() << " props/s"
+           << setw(10) << r.peak << " KB" << endl;
+    else
+      cout << "skipped (cannot run "
+           << (b.fzn != NULL ? fzn : b.exe) << ")" << endl;
+    rs.push_back(r);
+  }
+
+  {
+    ofstream os(out);
+    if (!os) {
+      cerr << "Cannot write results to " << out << endl;
+      return EXIT_FAILURE;
+    }
+    json(os,rs);
+  }
+
+  if (base == NULL)
+    return EXIT_SUCCESS;
+
+  vector<Result> bs;
+  if (!baseline(base,bs)) {
+    cerr << "Cannot read baseline from " << base << endl;
+    return EXIT_FAILURE;
+  }
+  int regressions = 0;
+  cout << endl << "Comparison with " << base
+       << " (threshold " << threshold << "%)" << endl;
+  for (const Result& r : rs) {
+    if (!r.ok)
+      continue;
+    for (const Result& b : bs) {
+      if (b.name != r.name)
+        continue;
+      double d = (b.wall > 0.0) ? (r.wall - b.wall) * 100.0 / b.wall : 0.0;
+      cout << left << setw(16) << r.name << right << fixed
+           << setprecision(1) << setw(8) << showpos << d << noshowpos << "%";
+      if (d > threshold) {
+        regressions++;
+        cout << "  REGRESSION";
+      }
+      if (r.nodes != b.nodes)
+        cout << "  (nodes changed: " << b.nodes << " -> " << r.nodes << ")";
+      cout << endl;
+    }
+  }
+  if (regressions > 0) {
+    cout << regressions << " regression(s) found" << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+// STATISTICS: bench-any
@@ -58,28 +58,42 @@ int main(int argc, char** argv) {
   FlatZinc::FlatZincSpace* fg = NULL;
   Rnd rnd(opt.seed());
   try {
+    fg = new FlatZinc::FlatZincSpace(rnd);
+    {
+      Search::Options so;
+      so.threads = opt.threads();
+      fg->prepareThreads(static_cast<unsigned int>(so.expand().threads));
+    }
     if (!strcmp(filename, "-")) {
-      fg = FlatZinc::parse(cin, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(cin, p, std::cerr, fg, rnd);
     } else {
-      fg = FlatZinc::parse(filename, p, std::cerr, NULL, rnd);
+      fg = FlatZinc::parse(filename, p, std::cerr, fg, rnd);
     }
 
     if (fg) {
       fg->createBranchers(p, fg->solveAnnotations(), opt,
                           false, std::cerr);
       fg->shrinkArrays(p);
+      std::ofstream ofs;
       if (opt.output()) {
-        std::ofstream os(opt.output());
-        if (!os.good()) {
+        ofs.open(opt.output());
+        if (!ofs.good()) {
           std::cerr << "Could not open file " << opt.output() << " for output."
                     << std::endl;
           exit(EXIT_FAILURE);
         }
+      }
+      std::ostream& os = opt.output() ? ofs : std::cout;
+      // Further runs reuse the posted model with the next seed
+      for (unsigned int r=0; r<opt.runs(); r++) {
+        if (r > 0) {
+          fg->reseed(static_cast<unsigned int>(opt.seed())+r);
+          t_total.start();
+        }
         fg->run(os, p, opt, t_total);
-        os.close();
-      } else {
-        fg->run(std::cout, p, opt, t_total);
       }
+      if (opt.output())
+        ofs.close();
     } else {
       exit(EXIT_FAILURE);
     }